@@ -0,0 +1,216 @@
+//
+// Created by regoeco on 18/01/17.
+//
+#include "batch.h"
+
+/**
+ *
+ * @param cubeSummation
+ * @param in
+ * @param out
+ * @param offline
+ * @return
+ */
+Batch *newBatch(CubeSummation *cubeSummation, FILE *in, FILE *out, int offline){
+    Batch *batch = malloc(sizeof(Batch));
+    batch->cubeSummation = cubeSummation;
+    batch->offline = offline ? newOffline(cubeSummation->execute) : NULL;
+    batch->warm = 0;
+    batch->in = in;
+    batch->out = out;
+    batch->in_len = 0;
+    batch->in_pos = 0;
+    batch->out_len = 0;
+    batch->num_updates = 0;
+    batch->num_queries = 0;
+    batch->run = _run_batch;
+    return batch;
+}
+
+/**
+ *
+ * @param this
+ */
+void destroyBatch(Batch *this){
+    if(this->offline != NULL)
+        destroyOffline(this->offline);
+    free(this);
+}
+
+/**
+ *
+ * @param this
+ * @return next input byte or EOF
+ */
+static inline int next_char(Batch *this){
+    if(this->in_pos == this->in_len){
+        this->in_len = fread(this->in_buffer, 1, BATCH_BUFFER_SIZE, this->in);
+        this->in_pos = 0;
+        if(this->in_len == 0)
+            return EOF;
+    }
+    return (unsigned char)this->in_buffer[this->in_pos++];
+}
+
+/**
+ *
+ * @param this
+ * @return first byte that is not a blank, or EOF
+ */
+static inline int skip_blanks(Batch *this){
+    int c;
+    do{
+        c = next_char(this);
+    }while(c == ' ' || c == '\n' || c == '\r' || c == '\t');
+    return c;
+}
+
+/**
+ *
+ * @param this
+ * @param value
+ * @return 0 at end of input or on a malformed number
+ */
+static int next_int(Batch *this, long long *value){
+    int c = skip_blanks(this);
+    int negative = 0;
+    long long v = 0;
+    if(c == '-' || c == '+'){
+        negative = c == '-';
+        c = next_char(this);
+    }
+    if(c < '0' || c > '9')
+        return 0;
+    while(c >= '0' && c <= '9'){
+        v = v*10 + (c - '0');
+        c = next_char(this);
+    }
+    *value = negative ? -v : v;
+    return 1;
+}
+
+/**
+ *
+ * @param this
+ * @param word
+ * @param size
+ * @return length of the word, 0 at end of input
+ */
+static size_t next_word(Batch *this, char *word, size_t size){
+    int c = skip_blanks(this);
+    size_t len = 0;
+    while(c != EOF && c != ' ' && c != '\n' && c != '\r' && c != '\t'){
+        if(len + 1 < size)
+            word[len++] = (char)c;
+        c = next_char(this);
+    }
+    word[len] = '\0';
+    return len;
+}
+
+/**
+ *
+ * @param this
+ */
+static void flush(Batch *this){
+    fwrite(this->out_buffer, 1, this->out_len, this->out);
+    this->out_len = 0;
+}
+
+/**
+ *
+ * @param this
+ * @param value
+ */
+static void write_int(Batch *this, long long value){
+    char digits[24];
+    int n = 0;
+    unsigned long long v = value < 0 ? 0ULL - (unsigned long long)value : (unsigned long long)value;
+    if(this->out_len + sizeof(digits) > BATCH_BUFFER_SIZE)
+        flush(this);
+    do{
+        digits[n++] = (char)('0' + v%10);
+        v /= 10;
+    }while(v > 0);
+    if(value < 0)
+        this->out_buffer[this->out_len++] = '-';
+    while(n > 0)
+        this->out_buffer[this->out_len++] = digits[--n];
+    this->out_buffer[this->out_len++] = '\n';
+}
+
+/**
+ *
+ * @param this
+ * @return
+ */
+int _run_batch(Batch *this){
+    Query *query = this->cubeSummation->execute;
+    long long T, N, M, v[6];
+    long long t, m;
+    char command[8];
+    int ok = 1;
+    if(!next_int(this, &T)){
+        fprintf(stderr, "\nERROR IN SIZE OF TEST\n");
+        return 0;
+    }
+    for(t = 0; t < T && ok; t++){
+        if(!next_int(this, &N) || !next_int(this, &M)){
+            fprintf(stderr, "\nERROR IN SIZE OF CUBE\n");
+            ok = 0;
+            break;
+        }
+        Offline *offline = N <= OFFLINE_MAX_SIZE ? this->offline : NULL;
+        if(this->warm && N != query->size)
+            fprintf(stderr, "\nWARNING TEST 1 HAS SIZE %lld, THE LOADED CUBE IS %d\n", N, query->size);
+        if(this->warm && N == query->size){
+            //the offline solver has no use for a loaded cube
+            offline = NULL;
+        }else if(offline != NULL ? !offline->reset(offline, (int)N) : !query->new_cube(query, (int)N)){
+            ok = 0;
+            break;
+        }
+        this->warm = 0;
+        for(m = 0; m < M; m++){
+            next_word(this, command, sizeof(command));
+            if(!strcmp("QUERY", command)){
+                if(!next_int(this, &v[0]) || !next_int(this, &v[1]) || !next_int(this, &v[2]) ||
+                   !next_int(this, &v[3]) || !next_int(this, &v[4]) || !next_int(this, &v[5])){
+                    ok = 0;
+                    break;
+                }
+                if(offline != NULL){
+                    offline->sum(offline, (int)v[0], (int)v[1], (int)v[2], (int)v[3], (int)v[4], (int)v[5]);
+                }else{
+                    long double sum = query->sum(query, (int)v[0], (int)v[1], (int)v[2], (int)v[3], (int)v[4], (int)v[5]);
+                    write_int(this, (long long)sum);
+                }
+                this->num_queries++;
+            }else if(!strcmp("UPDATE", command)){
+                if(!next_int(this, &v[0]) || !next_int(this, &v[1]) || !next_int(this, &v[2]) || !next_int(this, &v[3])){
+                    ok = 0;
+                    break;
+                }
+                if(offline != NULL)
+                    offline->update(offline, (int)v[0], (int)v[1], (int)v[2], (int)v[3]);
+                else
+                    query->update(query, (int)v[0], (int)v[1], (int)v[2], (int)v[3]);
+                this->num_updates++;
+            }else{
+                ok = 0;
+                break;
+            }
+        }
+        if(offline != NULL){
+            long long *answers = offline->solve(offline);
+            unsigned int q;
+            for(q = 0; q < offline->num_answers; q++)
+                write_int(this, answers[q]);
+        }
+        if(!ok)
+            fprintf(stderr, "\nERROR GETTING LINE %lld OF TEST %lld\n", m + 1, t + 1);
+    }
+    flush(this);
+    fflush(this->out);
+    return ok;
+}
@@ -0,0 +1,70 @@
+//
+// Created by regoeco on 18/01/17.
+//
+
+#ifndef DATA_STRUCTURES_BATCH_H
+#define DATA_STRUCTURES_BATCH_H
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cube_summation.h"
+#include "offline.h"
+
+#define BATCH_BUFFER_SIZE (1 << 16)
+
+/**
+ * Streams CubeSummation test cases from a FILE:
+ *
+ *  T
+ *  N M            (T times)
+ *  UPDATE x y z W (M commands per test case)
+ *  QUERY x1 y1 z1 x2 y2 z2
+ *
+ * and writes the sum of every QUERY on its own line. Input is tokenized in
+ * place from a fixed read buffer and output goes through a fixed write
+ * buffer, so a run allocates nothing per command. In offline mode each
+ * test case is read whole and answered by Offline, the output is the same.
+ * With warm set, the first test case goes on with the cube the query
+ * already holds (e.g. from loadSnapshot) when its N matches the size.
+ */
+typedef struct Batch Batch;
+struct Batch{
+    CubeSummation *cubeSummation;
+    Offline *offline;//NULL runs every command as it is read
+    int warm;//the first test case starts from the cube of the query
+    FILE *in;
+    FILE *out;
+    char in_buffer[BATCH_BUFFER_SIZE];
+    size_t in_len;
+    size_t in_pos;
+    char out_buffer[BATCH_BUFFER_SIZE];
+    size_t out_len;
+    unsigned long num_updates;
+    unsigned long num_queries;
+    int (*run)(Batch *this);
+};
+
+/**
+ *
+ * @param cubeSummation
+ * @param in
+ * @param out
+ * @param offline
+ * @return
+ */
+Batch *newBatch(CubeSummation *cubeSummation, FILE *in, FILE *out, int offline);
+
+/**
+ *
+ * @param this
+ */
+void destroyBatch(Batch *this);
+
+/**
+ *
+ * @param this
+ * @return 1 if every test case was read and executed
+ */
+static int _run_batch(Batch *this);
+
+#endif //DATA_STRUCTURES_BATCH_H
@@ -0,0 +1,272 @@
+//
+// Created by regoeco on 18/01/17.
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include "cube_summation.h"
+
+/**
+ * usage: cube_benchmark [-n size] [-m commands] [-r read_ratio]
+ *                       [-b uniform|small|full|point] [-s seed] [-t threads]
+ *
+ * Generates a reproducible mix of UPDATE/QUERY commands and replays it
+ * against every Query mode, reporting throughput, latency percentiles and a
+ * checksum of the sums (all modes must agree on it).
+ */
+
+typedef enum BoxType{ UNIFORM, SMALL, FULL, POINT }BoxType;
+
+typedef struct Command{
+    int is_query;
+    int v[6];
+}Command;
+
+typedef struct Workload{
+    int size;
+    unsigned int num_commands;
+    double read_ratio;
+    BoxType boxType;
+    unsigned long long seed;
+    Command *commands;
+}Workload;
+
+/**
+ *
+ * @param state
+ * @return
+ */
+static unsigned long long next_random(unsigned long long *state){
+    unsigned long long x = *state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *state = x;
+    return x*0x2545F4914F6CDD1DULL;
+}
+
+/**
+ *
+ * @param state
+ * @param lo
+ * @param hi
+ * @return uniform in [lo, hi]
+ */
+static int random_between(unsigned long long *state, int lo, int hi){
+    return lo + (int)(next_random(state)%(unsigned long long)(hi - lo + 1));
+}
+
+/**
+ *
+ * @param state
+ * @param boxType
+ * @param size
+ * @param lo
+ * @param hi
+ */
+static void random_side(unsigned long long *state, BoxType boxType, int size, int *lo, int *hi){
+    switch (boxType){
+        case SMALL:{
+            int side = random_between(state, 1, size/10 > 1 ? size/10 : 1);
+            *lo = random_between(state, 1, size - side + 1);
+            *hi = *lo + side - 1;
+            break;
+        }
+        case FULL:
+            *lo = 1;
+            *hi = size;
+            break;
+        case POINT:
+            *lo = *hi = random_between(state, 1, size);
+            break;
+        default:{
+            int a = random_between(state, 1, size);
+            int b = random_between(state, 1, size);
+            *lo = a < b ? a : b;
+            *hi = a < b ? b : a;
+            break;
+        }
+    }
+}
+
+/**
+ *
+ * @param this
+ */
+static void generate(Workload *this){
+    unsigned long long state = this->seed ? this->seed : 1;
+    unsigned int i;
+    this->commands = malloc(this->num_commands*sizeof(Command));
+    for(i = 0; i < this->num_commands; i++){
+        Command *c = &this->commands[i];
+        c->is_query = (double)(next_random(&state) >> 11)/(double)(1ULL << 53) < this->read_ratio;
+        if(c->is_query){
+            random_side(&state, this->boxType, this->size, &c->v[0], &c->v[3]);
+            random_side(&state, this->boxType, this->size, &c->v[1], &c->v[4]);
+            random_side(&state, this->boxType, this->size, &c->v[2], &c->v[5]);
+        }else{
+            c->v[0] = random_between(&state, 1, this->size);
+            c->v[1] = random_between(&state, 1, this->size);
+            c->v[2] = random_between(&state, 1, this->size);
+            c->v[3] = random_between(&state, -999999999, 999999999);
+        }
+    }
+}
+
+/**
+ *
+ * @return
+ */
+static long long now_ns(void){
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (long long)t.tv_sec*1000000000LL + t.tv_nsec;
+}
+
+/**
+ *
+ * @param a
+ * @param b
+ * @return
+ */
+static int compare_ns(const void *a, const void *b){
+    long long x = *(const long long*)a, y = *(const long long*)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ *
+ * @param sorted
+ * @param n
+ * @param p
+ * @return
+ */
+static long long percentile(const long long *sorted, unsigned int n, double p){
+    if(n == 0)
+        return 0;
+    unsigned int i = (unsigned int)(p*(n - 1) + 0.5);
+    return sorted[i];
+}
+
+/**
+ *
+ * @param name
+ * @param kind
+ * @param latencies
+ * @param n
+ */
+static void report(const char *name, const char *kind, long long *latencies, unsigned int n){
+    qsort(latencies, n, sizeof(long long), compare_ns);
+    printf("%-10s %-6s %10u %10lld %10lld %10lld %10lld\n", name, kind, n,
+           percentile(latencies, n, 0.50), percentile(latencies, n, 0.90),
+           percentile(latencies, n, 0.99), n > 0 ? latencies[n - 1] : 0);
+}
+
+/**
+ *
+ * @param workload
+ * @param queryType
+ * @param name
+ * @param threads
+ * @return checksum of the sums
+ */
+static long long run(const Workload *workload, QueryType queryType, const char *name, int threads){
+    CubeSummation *cubeSummation = newCubeSummation(workload->size, -1e9, 1e9, queryType);
+    Query *query = cubeSummation->execute;
+    long long *sums = malloc(workload->num_commands*sizeof(long long));
+    long long *updates = malloc(workload->num_commands*sizeof(long long));
+    unsigned int num_sums = 0, num_updates = 0, i;
+    long long checksum = 0;
+
+    if(threads > 1)
+        query->set_parallel(query, threads, 1 << 16);
+    query->new_cube(query, workload->size);
+    long long start = now_ns();
+    for(i = 0; i < workload->num_commands; i++){
+        const Command *c = &workload->commands[i];
+        long long t = now_ns();
+        if(c->is_query){
+            checksum += (long long)query->sum(query, c->v[0], c->v[1], c->v[2], c->v[3], c->v[4], c->v[5]);
+            sums[num_sums++] = now_ns() - t;
+        }else{
+            query->update(query, c->v[0], c->v[1], c->v[2], c->v[3]);
+            updates[num_updates++] = now_ns() - t;
+        }
+    }
+    double seconds = (double)(now_ns() - start)/1e9;
+
+    printf("%-10s %-6s %10.3f s %12.0f ops/s  rebuilds %lu  checksum %lld\n", name, "total", seconds,
+           workload->num_commands/(seconds > 0 ? seconds : 1e-9), query->stats.num_rebuilds, checksum);
+    report(name, "query", sums, num_sums);
+    report(name, "update", updates, num_updates);
+
+    free(sums);
+    free(updates);
+    destroyCubeSummation(cubeSummation);
+    return checksum;
+}
+
+int main(int argc, char** argv){
+    Workload workload = { 100, 100000, 0.5, UNIFORM, 42, NULL };
+    int threads = 1;
+    int opt;
+    while((opt = getopt(argc, argv, "n:m:r:b:s:t:")) != -1){
+        switch (opt){
+            case 'n':
+                workload.size = atoi(optarg);
+                break;
+            case 'm':
+                workload.num_commands = (unsigned int)strtoul(optarg, NULL, 10);
+                break;
+            case 'r':
+                workload.read_ratio = atof(optarg);
+                break;
+            case 'b':
+                if(!strcmp("small", optarg))
+                    workload.boxType = SMALL;
+                else if(!strcmp("full", optarg))
+                    workload.boxType = FULL;
+                else if(!strcmp("point", optarg))
+                    workload.boxType = POINT;
+                else
+                    workload.boxType = UNIFORM;
+                break;
+            case 's':
+                workload.seed = strtoull(optarg, NULL, 10);
+                break;
+            case 't':
+                threads = atoi(optarg);
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-n size] [-m commands] [-r read_ratio] [-b uniform|small|full|point] [-s seed] [-t threads]\n", argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+    if(workload.size < 1 || workload.num_commands < 1){
+        fprintf(stderr, "\nERROR IN SIZE OF CUBE OR COMMANDS\n");
+        return EXIT_FAILURE;
+    }
+
+    generate(&workload);
+    printf("N=%d M=%u read_ratio=%.2f seed=%llu kernel=%s\n", workload.size, workload.num_commands,
+           workload.read_ratio, workload.seed, getSumKernel().name);
+    printf("%-10s %-6s %10s %10s %10s %10s %10s\n", "mode", "op", "count", "p50 ns", "p90 ns", "p99 ns", "max ns");
+
+    QueryType types[] = { NAIVE, FENWICK, PREFIX_SUM, SPARSE };
+    const char *names[] = { "naive", "fenwick", "prefix", "sparse" };
+    long long reference = 0;
+    int ok = 1, i;
+    for(i = 0; i < 4; i++){
+        long long checksum = run(&workload, types[i], names[i], threads);
+        if(i == 0)
+            reference = checksum;
+        else if(checksum != reference){
+            printf("ERROR CHECKSUM OF %s DIFFERS FROM naive\n", names[i]);
+            ok = 0;
+        }
+    }
+    free(workload.commands);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -9,11 +9,12 @@
  * @param max_size
  * @param max_value
  * @param min_value
+ * @param queryType
  * @return
  */
-CubeSummation* newCubeSummation( int max_size, double max_value, double min_value){
+CubeSummation* newCubeSummation( int max_size, double max_value, double min_value, QueryType queryType){
     CubeSummation *cubeSummation = malloc(sizeof(CubeSummation));
-    cubeSummation->execute = newQuery(max_size, max_value, min_value);
+    cubeSummation->execute = newQuery(max_size, max_value, min_value, queryType);
 
 
     return cubeSummation;
@@ -25,6 +26,5 @@ CubeSummation* newCubeSummation( int max_size, double max_value, double min_valu
  */
 void destroyCubeSummation(CubeSummation *this){
     destroyQuery(this->execute);
-    free(this->execute);
     free(this);
 }
\ No newline at end of file
@@ -18,9 +18,10 @@ struct CubeSummation{
  * @param max_size
  * @param max_value
  * @param min_value
+ * @param queryType
  * @return
  */
-CubeSummation* newCubeSummation( int max_size, double max_value, double min_value);
+CubeSummation* newCubeSummation( int max_size, double max_value, double min_value, QueryType queryType);
 
 /**
  *
@@ -5,31 +5,49 @@
 
 /**
  *
+ * @details The cube and its cells share one aligned allocation, the cells
+ * start at the first CUBE_ALIGNMENT boundary after the struct.
  * @param size
- * @return
+ * @return NULL if size^3 does not fit in an int or out of memory
  */
 Cube *newCube(int size){
-    Cube *cube = malloc(sizeof(Cube));
+    if(size < 1 || (size_t)size*(size_t)size > INT_MAX/(size_t)size)
+        return NULL;
+    size_t header = (sizeof(Cube) + CUBE_ALIGNMENT - 1) & ~(size_t)(CUBE_ALIGNMENT - 1);
+    size_t bytes = CUBE_INDEX(size, size, 0, 0)*sizeof(int);
+    void *block = NULL;
+    if(posix_memalign(&block, CUBE_ALIGNMENT, header + bytes) != 0)
+        return NULL;
+    Cube *cube = block;
     cube->size = size;
     cube->num_elements = size*size*size;
-    cube->get_data = _get_data_cube;
+    cube->data = (int*)((char*)block + header);
     cube->get_num_elements = _get_num_elements_cube;
     cube->get_size = _get_size_cube;
-    cube->set_size = _set_size_cube;
+    cube->get = _get_cube;
+    cube->set = _set_cube;
+    cube->get_row = _get_row_cube;
+    memset(cube->data, 0, bytes);
 
-    cube->data = calloc((size_t)size, sizeof(int*));
-    int i = 0, j = 0, k = 0;
-    for(i = 0; i < size; i++){
-        cube->data[i] = calloc((size_t)size, sizeof(int*));
-        for (j = 0; j < size; j++) {
-            cube->data[i][j] = calloc((size_t)size, sizeof(int*));
-        }
-    }
+    return cube;
+}
 
-    for(i = 0; i< size; i++)
-        for(j = 0; j < size; j++)
-            for(k=0; k<size; k++)
-                cube->data[i][j][k] = 0;
+/**
+ *
+ * @param size
+ * @param data
+ * @return
+ */
+Cube *newCubeFrom(int size, int *data){
+    Cube *cube = malloc(sizeof(Cube));
+    cube->size = size;
+    cube->num_elements = size*size*size;
+    cube->data = data;
+    cube->get_num_elements = _get_num_elements_cube;
+    cube->get_size = _get_size_cube;
+    cube->get = _get_cube;
+    cube->set = _set_cube;
+    cube->get_row = _get_row_cube;
 
     return cube;
 }
@@ -39,18 +57,6 @@ Cube *newCube(int size){
  * @param cube
  */
 void destroyCube(Cube *cube){
-    int size = cube->get_size(cube);
-    int i = 0;
-    int j = 0;
-    int ***d;
-    for(i = 0; i < size; i++){
-        for(j = 0; j < size; j++){
-            d = cube->get_data(cube);
-            free(d[i][j]);
-        }
-        free(d[i]);
-    }
-    free(cube->data);
     free(cube);
 }
 
@@ -75,17 +81,34 @@ void destroyCube(Cube *cube){
 /**
  *
  * @param cube
+ * @param x
+ * @param y
+ * @param z
  * @return
  */
- int*** _get_data_cube(Cube* cube){
-    return cube->data;
+ int _get_cube(Cube *cube, int x, int y, int z){
+    return cube->data[CUBE_INDEX(cube->size, x, y, z)];
 }
 
 /**
  *
  * @param cube
- * @param size
+ * @param x
+ * @param y
+ * @param z
+ * @param value
  */
- void _set_size_cube(Cube *cube, int size){
-    cube->size = size;
-}
\ No newline at end of file
+ void _set_cube(Cube *cube, int x, int y, int z, int value){
+    cube->data[CUBE_INDEX(cube->size, x, y, z)] = value;
+}
+
+/**
+ *
+ * @param cube
+ * @param x
+ * @param y
+ * @return
+ */
+ int* _get_row_cube(Cube *cube, int x, int y){
+    return cube->data + CUBE_INDEX(cube->size, x, y, 0);
+}
@@ -5,16 +5,28 @@
 #ifndef DATA_STRUCTURES_CUBE_H
 #define DATA_STRUCTURES_CUBE_H
 #include <malloc.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#define CUBE_ALIGNMENT 64
+
+/**
+ * Offset of the cell (x, y, z) (0-based) inside the flat buffer of a cube
+ * of side size. z is the contiguous axis, so a z-run is a linear scan.
+ */
+#define CUBE_INDEX(size, x, y, z) ((((size_t)(x)*(size_t)(size)) + (size_t)(y))*(size_t)(size) + (size_t)(z))
 
 typedef struct Cube Cube;
-typedef struct Cube{
+struct Cube{
     int size;
     int num_elements;//size*size*size
-    int ***data;
+    int *data;//aligned, size*size*size cells in the same block as the cube
     int (*get_size)(Cube *cube);
     int (*get_num_elements)(Cube *cube);
-    int*** (*get_data)(Cube* cube);
-    void (*set_size)(Cube *cube, int size);
+    int (*get)(Cube *cube, int x, int y, int z);
+    void (*set)(Cube *cube, int x, int y, int z, int value);
+    int* (*get_row)(Cube *cube, int x, int y);
 };
 /**
  *
@@ -23,6 +35,16 @@ typedef struct Cube{
  */
 Cube *newCube(int size);
 
+/**
+ *
+ * @details The cells are borrowed (e.g. from a mapped snapshot), destroyCube
+ * only releases the struct.
+ * @param size
+ * @param data size*size*size cells
+ * @return
+ */
+Cube *newCubeFrom(int size, int *data);
+
 /**
  *
  * @param cube
@@ -46,15 +68,30 @@ static int _get_num_elements_cube(Cube *cube);
 /**
  *
  * @param cube
+ * @param x
+ * @param y
+ * @param z
  * @return
  */
-static int*** _get_data_cube(Cube* cube);
+static int _get_cube(Cube *cube, int x, int y, int z);
 
 /**
  *
  * @param cube
- * @param size
+ * @param x
+ * @param y
+ * @param z
+ * @param value
+ */
+static void _set_cube(Cube *cube, int x, int y, int z, int value);
+
+/**
+ *
+ * @param cube
+ * @param x
+ * @param y
+ * @return the size cells of the z-run at (x, y)
  */
-static void _set_size_cube(Cube *cube, int size);
+static int* _get_row_cube(Cube *cube, int x, int y);
 
 #endif //DATA_STRUCTURES_CUBE_H
@@ -0,0 +1,86 @@
+//
+// Created by regoeco on 18/01/17.
+//
+#include "fenwick.h"
+
+/**
+ *
+ * @param size
+ * @return NULL if out of memory
+ */
+Fenwick *newFenwick(int size){
+    Fenwick *fenwick = malloc(sizeof(Fenwick));
+    size_t side = (size_t)size + 1;
+    fenwick->size = size;
+    fenwick->tree = calloc(side*side*side, sizeof(long long));
+    if(fenwick->tree == NULL){
+        free(fenwick);
+        return NULL;
+    }
+    fenwick->owner = 1;
+    fenwick->update = _update_fenwick;
+    fenwick->sum = _sum_fenwick;
+    return fenwick;
+}
+
+/**
+ *
+ * @param size
+ * @param tree
+ * @return
+ */
+Fenwick *newFenwickFrom(int size, long long *tree){
+    Fenwick *fenwick = malloc(sizeof(Fenwick));
+    fenwick->size = size;
+    fenwick->tree = tree;
+    fenwick->owner = 0;
+    fenwick->update = _update_fenwick;
+    fenwick->sum = _sum_fenwick;
+    return fenwick;
+}
+
+/**
+ *
+ * @param this
+ */
+void destroyFenwick(Fenwick *this){
+    if(this->owner)
+        free(this->tree);
+    free(this);
+}
+
+/**
+ *
+ * @param this
+ * @param x
+ * @param y
+ * @param z
+ * @param delta
+ */
+void _update_fenwick(Fenwick *this, int x, int y, int z, long long delta){
+    size_t side = (size_t)this->size + 1;
+    int i, j, k;
+    for(i = x; i <= this->size; i += i & -i)
+        for(j = y; j <= this->size; j += j & -j)
+            for(k = z; k <= this->size; k += k & -k)
+                this->tree[((size_t)i*side + j)*side + k] += delta;
+}
+
+/**
+ *
+ * @param this
+ * @param x
+ * @param y
+ * @param z
+ * @return
+ */
+long long _sum_fenwick(Fenwick *this, int x, int y, int z){
+    size_t side = (size_t)this->size + 1;
+    long long sum = 0;
+    int i, j, k;
+    for(i = x; i > 0; i -= i & -i)
+        for(j = y; j > 0; j -= j & -j)
+            for(k = z; k > 0; k -= k & -k)
+                sum += this->tree[((size_t)i*side + j)*side + k];
+    return sum;
+}
@@ -0,0 +1,65 @@
+//
+// Created by regoeco on 18/01/17.
+//
+
+#ifndef DATA_STRUCTURES_FENWICK_H
+#define DATA_STRUCTURES_FENWICK_H
+#include <malloc.h>
+
+/**
+ * Binary indexed tree over a size*size*size cube. Coordinates are 1-based,
+ * update() adds a delta to one cell and sum() returns the prefix sum of the
+ * box (1,1,1)-(x,y,z); both run in O(log^3 size).
+ */
+typedef struct Fenwick Fenwick;
+struct Fenwick{
+    int size;
+    long long *tree;//(size+1)*(size+1)*(size+1)
+    int owner;//0 if tree is borrowed
+    void (*update)(Fenwick *this, int x, int y, int z, long long delta);
+    long long (*sum)(Fenwick *this, int x, int y, int z);
+};
+
+/**
+ *
+ * @param size
+ * @return
+ */
+Fenwick *newFenwick(int size);
+
+/**
+ *
+ * @details The tree is borrowed, destroyFenwick does not free it.
+ * @param size
+ * @param tree
+ * @return
+ */
+Fenwick *newFenwickFrom(int size, long long *tree);
+
+/**
+ *
+ * @param this
+ */
+void destroyFenwick(Fenwick *this);
+
+/**
+ *
+ * @param this
+ * @param x
+ * @param y
+ * @param z
+ * @param delta
+ */
+static void _update_fenwick(Fenwick *this, int x, int y, int z, long long delta);
+
+/**
+ *
+ * @param this
+ * @param x
+ * @param y
+ * @param z
+ * @return
+ */
+static long long _sum_fenwick(Fenwick *this, int x, int y, int z);
+
+#endif //DATA_STRUCTURES_FENWICK_H
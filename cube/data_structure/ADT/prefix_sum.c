@@ -0,0 +1,102 @@
+//
+// Created by regoeco on 18/01/17.
+//
+#include "prefix_sum.h"
+
+#define PREFIX_INDEX(side, x, y, z) ((((size_t)(x)*(side)) + (size_t)(y))*(side) + (size_t)(z))
+
+/**
+ *
+ * @param size
+ * @return NULL if out of memory
+ */
+PrefixSum *newPrefixSum(int size){
+    PrefixSum *prefixSum = malloc(sizeof(PrefixSum));
+    size_t side = (size_t)size + 1;
+    prefixSum->size = size;
+    prefixSum->table = calloc(side*side*side, sizeof(long long));
+    if(prefixSum->table == NULL){
+        free(prefixSum);
+        return NULL;
+    }
+    prefixSum->owner = 1;
+    prefixSum->build = _build_prefix_sum;
+    prefixSum->sum = _sum_prefix_sum;
+    return prefixSum;
+}
+
+/**
+ *
+ * @param size
+ * @param table
+ * @return
+ */
+PrefixSum *newPrefixSumFrom(int size, long long *table){
+    PrefixSum *prefixSum = malloc(sizeof(PrefixSum));
+    prefixSum->size = size;
+    prefixSum->table = table;
+    prefixSum->owner = 0;
+    prefixSum->build = _build_prefix_sum;
+    prefixSum->sum = _sum_prefix_sum;
+    return prefixSum;
+}
+
+/**
+ *
+ * @param this
+ */
+void destroyPrefixSum(PrefixSum *this){
+    if(this->owner)
+        free(this->table);
+    free(this);
+}
+
+/**
+ *
+ * @details One pass per axis: running sums along z, then y, then x.
+ * @param this
+ * @param cube
+ */
+void _build_prefix_sum(PrefixSum *this, Cube *cube){
+    size_t side = (size_t)this->size + 1;
+    long long *t = this->table;
+    int x, y, z;
+    for(x = 1; x <= this->size; x++)
+        for(y = 1; y <= this->size; y++){
+            int *row = cube->get_row(cube, x-1, y-1);
+            long long run = 0;
+            for(z = 1; z <= this->size; z++){
+                run += row[z-1];
+                t[PREFIX_INDEX(side, x, y, z)] = run;
+            }
+        }
+    for(x = 1; x <= this->size; x++)
+        for(y = 2; y <= this->size; y++)
+            for(z = 1; z <= this->size; z++)
+                t[PREFIX_INDEX(side, x, y, z)] += t[PREFIX_INDEX(side, x, y-1, z)];
+    for(x = 2; x <= this->size; x++)
+        for(y = 1; y <= this->size; y++)
+            for(z = 1; z <= this->size; z++)
+                t[PREFIX_INDEX(side, x, y, z)] += t[PREFIX_INDEX(side, x-1, y, z)];
+}
+
+/**
+ *
+ * @param this
+ * @param x1
+ * @param y1
+ * @param z1
+ * @param x2
+ * @param y2
+ * @param z2
+ * @return
+ */
+long long _sum_prefix_sum(PrefixSum *this, int x1, int y1, int z1, int x2, int y2, int z2){
+    size_t side = (size_t)this->size + 1;
+    long long *t = this->table;
+    x1--; y1--; z1--;
+    return t[PREFIX_INDEX(side, x2, y2, z2)]
+           - t[PREFIX_INDEX(side, x1, y2, z2)] - t[PREFIX_INDEX(side, x2, y1, z2)] - t[PREFIX_INDEX(side, x2, y2, z1)]
+           + t[PREFIX_INDEX(side, x1, y1, z2)] + t[PREFIX_INDEX(side, x1, y2, z1)] + t[PREFIX_INDEX(side, x2, y1, z1)]
+           - t[PREFIX_INDEX(side, x1, y1, z1)];
+}
@@ -0,0 +1,66 @@
+//
+// Created by regoeco on 18/01/17.
+//
+
+#ifndef DATA_STRUCTURES_PREFIX_SUM_H
+#define DATA_STRUCTURES_PREFIX_SUM_H
+#include <malloc.h>
+#include "cube.h"
+
+/**
+ * 3D summed-area table of a cube. table[x][y][z] holds the sum of the box
+ * (1,1,1)-(x,y,z), so any box sum is eight lookups. The table does not
+ * follow the cube, it has to be rebuilt after the cube changes.
+ */
+typedef struct PrefixSum PrefixSum;
+struct PrefixSum{
+    int size;
+    long long *table;//(size+1)*(size+1)*(size+1)
+    int owner;//0 if table is borrowed
+    void (*build)(PrefixSum *this, Cube *cube);
+    long long (*sum)(PrefixSum *this, int x1, int y1, int z1, int x2, int y2, int z2);
+};
+
+/**
+ *
+ * @param size
+ * @return
+ */
+PrefixSum *newPrefixSum(int size);
+
+/**
+ *
+ * @details The table is borrowed, destroyPrefixSum does not free it.
+ * @param size
+ * @param table
+ * @return
+ */
+PrefixSum *newPrefixSumFrom(int size, long long *table);
+
+/**
+ *
+ * @param this
+ */
+void destroyPrefixSum(PrefixSum *this);
+
+/**
+ *
+ * @param this
+ * @param cube
+ */
+static void _build_prefix_sum(PrefixSum *this, Cube *cube);
+
+/**
+ *
+ * @param this
+ * @param x1
+ * @param y1
+ * @param z1
+ * @param x2
+ * @param y2
+ * @param z2
+ * @return
+ */
+static long long _sum_prefix_sum(PrefixSum *this, int x1, int y1, int z1, int x2, int y2, int z2);
+
+#endif //DATA_STRUCTURES_PREFIX_SUM_H
@@ -0,0 +1,234 @@
+//
+// Created by regoeco on 18/01/17.
+//
+#include "sparse_cube.h"
+
+/**
+ *
+ * @param x
+ * @param y
+ * @param z
+ * @return
+ */
+static unsigned int hash_cell(int x, int y, int z){
+    unsigned long long h = (unsigned int)x;
+    h = h*0x9E3779B97F4A7C15ULL + (unsigned int)y;
+    h = h*0x9E3779B97F4A7C15ULL + (unsigned int)z;
+    h ^= h >> 29;
+    h *= 0xBF58476D1CE4E5B9ULL;
+    return (unsigned int)(h ^ (h >> 32));
+}
+
+/**
+ *
+ * @param capacity
+ * @return
+ */
+static SparseCell *newCells(unsigned int capacity){
+    SparseCell *cells = malloc(capacity*sizeof(SparseCell));
+    if(cells != NULL)
+        memset(cells, 0xFF, capacity*sizeof(SparseCell));
+    return cells;
+}
+
+/**
+ *
+ * @param this
+ * @param x
+ * @param y
+ * @param z
+ * @return slot of the cell, or of the free slot where it would go
+ */
+static unsigned int find_slot(SparseCube *this, int x, int y, int z){
+    unsigned int mask = this->capacity - 1;
+    unsigned int i = hash_cell(x, y, z) & mask;
+    while(this->cells[i].x >= 0){
+        SparseCell *c = &this->cells[i];
+        if(c->x == x && c->y == y && c->z == z)
+            break;
+        i = (i + 1) & mask;
+    }
+    return i;
+}
+
+/**
+ *
+ * @param this
+ * @param capacity
+ * @return
+ */
+static int resize(SparseCube *this, unsigned int capacity){
+    SparseCell *old = this->cells;
+    unsigned int old_capacity = this->capacity;
+    unsigned int i;
+    SparseCell *cells = newCells(capacity);
+    if(cells == NULL)
+        return 0;
+    this->cells = cells;
+    this->capacity = capacity;
+    for(i = 0; i < old_capacity; i++){
+        if(old[i].x >= 0)
+            this->cells[find_slot(this, old[i].x, old[i].y, old[i].z)] = old[i];
+    }
+    if(this->owner)
+        free(old);
+    this->owner = 1;
+    return 1;
+}
+
+/**
+ *
+ * @param size
+ * @return
+ */
+SparseCube *newSparseCube(int size){
+    SparseCube *sparseCube = malloc(sizeof(SparseCube));
+    sparseCube->size = size;
+    sparseCube->num_elements = 0;
+    sparseCube->capacity = SPARSE_CUBE_MIN_CAPACITY;
+    sparseCube->cells = newCells(SPARSE_CUBE_MIN_CAPACITY);
+    sparseCube->owner = 1;
+    sparseCube->get_size = _get_size_sparse_cube;
+    sparseCube->get_num_elements = _get_num_elements_sparse_cube;
+    sparseCube->get = _get_sparse_cube;
+    sparseCube->set = _set_sparse_cube;
+    sparseCube->sum = _sum_sparse_cube;
+    return sparseCube;
+}
+
+/**
+ *
+ * @param size
+ * @param cells
+ * @param capacity
+ * @param num_elements
+ * @return
+ */
+SparseCube *newSparseCubeFrom(int size, SparseCell *cells, unsigned int capacity, unsigned int num_elements){
+    SparseCube *sparseCube = malloc(sizeof(SparseCube));
+    sparseCube->size = size;
+    sparseCube->num_elements = num_elements;
+    sparseCube->capacity = capacity;
+    sparseCube->cells = cells;
+    sparseCube->owner = 0;
+    sparseCube->get_size = _get_size_sparse_cube;
+    sparseCube->get_num_elements = _get_num_elements_sparse_cube;
+    sparseCube->get = _get_sparse_cube;
+    sparseCube->set = _set_sparse_cube;
+    sparseCube->sum = _sum_sparse_cube;
+    return sparseCube;
+}
+
+/**
+ *
+ * @param this
+ */
+void destroySparseCube(SparseCube *this){
+    if(this->owner)
+        free(this->cells);
+    free(this);
+}
+
+/**
+ *
+ * @param this
+ * @return
+ */
+int _get_size_sparse_cube(SparseCube *this){
+    return this->size;
+}
+
+/**
+ *
+ * @param this
+ * @return
+ */
+unsigned int _get_num_elements_sparse_cube(SparseCube *this){
+    return this->num_elements;
+}
+
+/**
+ *
+ * @param this
+ * @param x
+ * @param y
+ * @param z
+ * @return
+ */
+int _get_sparse_cube(SparseCube *this, int x, int y, int z){
+    SparseCell *c = &this->cells[find_slot(this, x, y, z)];
+    return c->x >= 0 ? c->value : 0;
+}
+
+/**
+ *
+ * @details Writing 0 removes the cell and shifts back the rest of its probe
+ * run, so the table never fills up with deleted markers.
+ * @param this
+ * @param x
+ * @param y
+ * @param z
+ * @param value
+ * @return
+ */
+int _set_sparse_cube(SparseCube *this, int x, int y, int z, int value){
+    unsigned int mask = this->capacity - 1;
+    unsigned int i = find_slot(this, x, y, z);
+    if(this->cells[i].x >= 0){
+        if(value != 0){
+            this->cells[i].value = value;
+            return 1;
+        }
+        unsigned int j = i;
+        for(;;){
+            j = (j + 1) & mask;
+            if(this->cells[j].x < 0)
+                break;
+            unsigned int home = hash_cell(this->cells[j].x, this->cells[j].y, this->cells[j].z) & mask;
+            //move j back to i unless its home lies cyclically in (i, j]
+            if( (i <= j) ? (i < home && home <= j) : (i < home || home <= j) )
+                continue;
+            this->cells[i] = this->cells[j];
+            i = j;
+        }
+        this->cells[i].x = -1;
+        this->num_elements--;
+        return 1;
+    }
+    if(value == 0)
+        return 1;
+    if( (this->num_elements + 1)*4 > this->capacity*3 ){
+        if(!resize(this, this->capacity*2))
+            return 0;
+        i = find_slot(this, x, y, z);
+    }
+    this->cells[i].x = x;
+    this->cells[i].y = y;
+    this->cells[i].z = z;
+    this->cells[i].value = value;
+    this->num_elements++;
+    return 1;
+}
+
+/**
+ *
+ * @details Scans the stored cells, O(capacity) whatever the size of the box.
+ * @param this
+ * @param x1
+ * @param y1
+ * @param z1
+ * @param x2
+ * @param y2
+ * @param z2
+ * @return
+ */
+long long _sum_sparse_cube(SparseCube *this, int x1, int y1, int z1, int x2, int y2, int z2){
+    long long sum = 0;
+    unsigned int i;
+    for(i = 0; i < this->capacity; i++){
+        SparseCell *c = &this->cells[i];
+        if(c->x >= x1 && c->x <= x2 && c->y >= y1 && c->y <= y2 && c->z >= z1 && c->z <= z2)
+            sum += c->value;
+    }
+    return sum;
+}
@@ -0,0 +1,111 @@
+//
+// Created by regoeco on 18/01/17.
+//
+
+#ifndef DATA_STRUCTURES_SPARSE_CUBE_H
+#define DATA_STRUCTURES_SPARSE_CUBE_H
+#include <malloc.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SPARSE_CUBE_MIN_CAPACITY 16
+
+/**
+ * Cube that only stores its non-zero cells, in an open addressing table
+ * (linear probing) keyed by (x, y, z). Memory grows with the number of
+ * written cells instead of size^3. Coordinates are 0-based like Cube.
+ */
+typedef struct SparseCell{
+    int x;//-1 marks a free slot
+    int y;
+    int z;
+    int value;
+}SparseCell;
+
+typedef struct SparseCube SparseCube;
+struct SparseCube{
+    int size;
+    unsigned int num_elements;//non-zero cells
+    unsigned int capacity;//power of two
+    SparseCell *cells;
+    int owner;//0 while cells is borrowed, the first resize takes a copy
+    int (*get_size)(SparseCube *this);
+    unsigned int (*get_num_elements)(SparseCube *this);
+    int (*get)(SparseCube *this, int x, int y, int z);
+    int (*set)(SparseCube *this, int x, int y, int z, int value);
+    long long (*sum)(SparseCube *this, int x1, int y1, int z1, int x2, int y2, int z2);
+};
+
+/**
+ *
+ * @param size
+ * @return
+ */
+SparseCube *newSparseCube(int size);
+
+/**
+ *
+ * @details The table is borrowed, destroySparseCube does not free it.
+ * @param size
+ * @param cells capacity slots laid out as by newSparseCube
+ * @param capacity power of two
+ * @param num_elements
+ * @return
+ */
+SparseCube *newSparseCubeFrom(int size, SparseCell *cells, unsigned int capacity, unsigned int num_elements);
+
+/**
+ *
+ * @param this
+ */
+void destroySparseCube(SparseCube *this);
+
+/**
+ *
+ * @param this
+ * @return
+ */
+static int _get_size_sparse_cube(SparseCube *this);
+
+/**
+ *
+ * @param this
+ * @return
+ */
+static unsigned int _get_num_elements_sparse_cube(SparseCube *this);
+
+/**
+ *
+ * @param this
+ * @param x
+ * @param y
+ * @param z
+ * @return
+ */
+static int _get_sparse_cube(SparseCube *this, int x, int y, int z);
+
+/**
+ *
+ * @param this
+ * @param x
+ * @param y
+ * @param z
+ * @param value 0 removes the cell
+ * @return
+ */
+static int _set_sparse_cube(SparseCube *this, int x, int y, int z, int value);
+
+/**
+ *
+ * @param this
+ * @param x1
+ * @param y1
+ * @param z1
+ * @param x2
+ * @param y2
+ * @param z2
+ * @return
+ */
+static long long _sum_sparse_cube(SparseCube *this, int x1, int y1, int z1, int x2, int y2, int z2);
+
+#endif //DATA_STRUCTURES_SPARSE_CUBE_H
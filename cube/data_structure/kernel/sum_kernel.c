@@ -0,0 +1,109 @@
+//
+// Created by regoeco on 18/01/17.
+//
+#include "sum_kernel.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SUM_KERNEL_X86 1
+#include <immintrin.h>
+#endif
+
+/**
+ *
+ * @param data
+ * @param n
+ * @return
+ */
+static long long sum_scalar(const int *data, int n){
+    long long sum = 0;
+    int i;
+    for(i = 0; i < n; i++)
+        sum += data[i];
+    return sum;
+}
+
+#ifdef SUM_KERNEL_X86
+/**
+ *
+ * @details Eight ints per step, widened to two vectors of four 64-bit lanes.
+ * @param data
+ * @param n
+ * @return
+ */
+__attribute__((target("avx2")))
+static long long sum_avx2(const int *data, int n){
+    __m256i acc0 = _mm256_setzero_si256();
+    __m256i acc1 = _mm256_setzero_si256();
+    long long lanes[4];
+    int i = 0;
+    for(; i + 8 <= n; i += 8){
+        __m256i v = _mm256_loadu_si256((const __m256i*)(data + i));
+        acc0 = _mm256_add_epi64(acc0, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+        acc1 = _mm256_add_epi64(acc1, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+    }
+    _mm256_storeu_si256((__m256i*)lanes, _mm256_add_epi64(acc0, acc1));
+    long long sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    for(; i < n; i++)
+        sum += data[i];
+    return sum;
+}
+
+/**
+ *
+ * @details Four ints per step, widened to two vectors of two 64-bit lanes.
+ * @param data
+ * @param n
+ * @return
+ */
+__attribute__((target("sse4.1")))
+static long long sum_sse41(const int *data, int n){
+    __m128i acc0 = _mm_setzero_si128();
+    __m128i acc1 = _mm_setzero_si128();
+    long long lanes[2];
+    int i = 0;
+    for(; i + 4 <= n; i += 4){
+        __m128i v = _mm_loadu_si128((const __m128i*)(data + i));
+        acc0 = _mm_add_epi64(acc0, _mm_cvtepi32_epi64(v));
+        acc1 = _mm_add_epi64(acc1, _mm_cvtepi32_epi64(_mm_srli_si128(v, 8)));
+    }
+    _mm_storeu_si128((__m128i*)lanes, _mm_add_epi64(acc0, acc1));
+    long long sum = lanes[0] + lanes[1];
+    for(; i < n; i++)
+        sum += data[i];
+    return sum;
+}
+#endif
+
+/**
+ *
+ * @return
+ */
+SumKernel getSumKernel(void){
+    static SumKernel kernel = { NULL, NULL };
+    if(kernel.sum == NULL){
+#ifdef SUM_KERNEL_X86
+        __builtin_cpu_init();
+        if(__builtin_cpu_supports("avx2")){
+            kernel.name = "avx2";
+            kernel.sum = sum_avx2;
+        }else if(__builtin_cpu_supports("sse4.1")){
+            kernel.name = "sse4.1";
+            kernel.sum = sum_sse41;
+        }else
+#endif
+        {
+            kernel.name = "scalar";
+            kernel.sum = sum_scalar;
+        }
+    }
+    return kernel;
+}
+
+/**
+ *
+ * @return
+ */
+SumKernel getScalarSumKernel(void){
+    SumKernel kernel = { "scalar", sum_scalar };
+    return kernel;
+}
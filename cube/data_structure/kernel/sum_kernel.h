@@ -0,0 +1,30 @@
+//
+// Created by regoeco on 18/01/17.
+//
+
+#ifndef DATA_STRUCTURES_SUM_KERNEL_H
+#define DATA_STRUCTURES_SUM_KERNEL_H
+
+/**
+ * Sum of a contiguous run of ints into 64-bit lanes. The implementation is
+ * picked once at runtime from what the CPU supports (AVX2, SSE4.1 or the
+ * portable scalar loop); name tells which one is in use.
+ */
+typedef struct SumKernel{
+    const char *name;
+    long long (*sum)(const int *data, int n);
+}SumKernel;
+
+/**
+ *
+ * @return the best kernel for this CPU
+ */
+SumKernel getSumKernel(void);
+
+/**
+ *
+ * @return the portable kernel, kept as a reference
+ */
+SumKernel getScalarSumKernel(void);
+
+#endif //DATA_STRUCTURES_SUM_KERNEL_H
@@ -0,0 +1,118 @@
+//
+// Created by regoeco on 18/01/17.
+//
+#include "thread_pool.h"
+
+/**
+ *
+ * @details Takes the next index of the current task, must hold the lock.
+ * @param this
+ * @return 1 if a task index was run
+ */
+static int run_next(ThreadPool *this){
+    if(this->next_task >= this->num_tasks)
+        return 0;
+    int index = this->next_task++;
+    void (*task)(void*, int) = this->task;
+    void *arg = this->arg;
+    pthread_mutex_unlock(&this->lock);
+    task(arg, index);
+    pthread_mutex_lock(&this->lock);
+    if(--this->pending == 0)
+        pthread_cond_signal(&this->done);
+    return 1;
+}
+
+/**
+ *
+ * @param p
+ * @return
+ */
+static void *worker(void *p){
+    ThreadPool *this = p;
+    pthread_mutex_lock(&this->lock);
+    while(!this->stop){
+        if(!run_next(this))
+            pthread_cond_wait(&this->work, &this->lock);
+    }
+    pthread_mutex_unlock(&this->lock);
+    return NULL;
+}
+
+/**
+ *
+ * @param num_threads
+ * @return
+ */
+ThreadPool *newThreadPool(int num_threads){
+    ThreadPool *pool = malloc(sizeof(ThreadPool));
+    int i;
+    pool->num_threads = 0;
+    pool->threads = malloc(sizeof(pthread_t)*(num_threads > 0 ? num_threads : 1));
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work, NULL);
+    pthread_cond_init(&pool->done, NULL);
+    pool->task = NULL;
+    pool->arg = NULL;
+    pool->num_tasks = 0;
+    pool->next_task = 0;
+    pool->pending = 0;
+    pool->stop = 0;
+    pool->get_num_threads = _get_num_threads_thread_pool;
+    pool->run = _run_thread_pool;
+    for(i = 0; i < num_threads; i++){
+        if(pthread_create(&pool->threads[i], NULL, worker, pool) != 0)
+            break;
+        pool->num_threads++;
+    }
+    return pool;
+}
+
+/**
+ *
+ * @param this
+ */
+void destroyThreadPool(ThreadPool *this){
+    int i;
+    pthread_mutex_lock(&this->lock);
+    this->stop = 1;
+    pthread_cond_broadcast(&this->work);
+    pthread_mutex_unlock(&this->lock);
+    for(i = 0; i < this->num_threads; i++)
+        pthread_join(this->threads[i], NULL);
+    pthread_cond_destroy(&this->done);
+    pthread_cond_destroy(&this->work);
+    pthread_mutex_destroy(&this->lock);
+    free(this->threads);
+    free(this);
+}
+
+/**
+ *
+ * @param this
+ * @return
+ */
+int _get_num_threads_thread_pool(ThreadPool *this){
+    return this->num_threads;
+}
+
+/**
+ *
+ * @param this
+ * @param task
+ * @param arg
+ * @param num_tasks
+ */
+void _run_thread_pool(ThreadPool *this, void (*task)(void *arg, int index), void *arg, int num_tasks){
+    pthread_mutex_lock(&this->lock);
+    this->task = task;
+    this->arg = arg;
+    this->num_tasks = num_tasks;
+    this->next_task = 0;
+    this->pending = num_tasks;
+    pthread_cond_broadcast(&this->work);
+    while(run_next(this));
+    while(this->pending > 0)
+        pthread_cond_wait(&this->done, &this->lock);
+    pthread_mutex_unlock(&this->lock);
+}
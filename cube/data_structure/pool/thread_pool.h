@@ -0,0 +1,61 @@
+//
+// Created by regoeco on 18/01/17.
+//
+
+#ifndef DATA_STRUCTURES_THREAD_POOL_H
+#define DATA_STRUCTURES_THREAD_POOL_H
+#include <malloc.h>
+#include <pthread.h>
+
+/**
+ * Fixed set of worker threads. run() hands out the indexes 0..num_tasks-1
+ * of a task to the workers and to the calling thread, and returns once all
+ * of them are done. Only one run() at a time per pool.
+ */
+typedef struct ThreadPool ThreadPool;
+struct ThreadPool{
+    int num_threads;
+    pthread_t *threads;
+    pthread_mutex_t lock;
+    pthread_cond_t work;
+    pthread_cond_t done;
+    void (*task)(void *arg, int index);
+    void *arg;
+    int num_tasks;
+    int next_task;
+    int pending;
+    int stop;
+    int (*get_num_threads)(ThreadPool *this);
+    void (*run)(ThreadPool *this, void (*task)(void *arg, int index), void *arg, int num_tasks);
+};
+
+/**
+ *
+ * @param num_threads workers besides the calling thread
+ * @return
+ */
+ThreadPool *newThreadPool(int num_threads);
+
+/**
+ *
+ * @param this
+ */
+void destroyThreadPool(ThreadPool *this);
+
+/**
+ *
+ * @param this
+ * @return
+ */
+static int _get_num_threads_thread_pool(ThreadPool *this);
+
+/**
+ *
+ * @param this
+ * @param task
+ * @param arg
+ * @param num_tasks
+ */
+static void _run_thread_pool(ThreadPool *this, void (*task)(void *arg, int index), void *arg, int num_tasks);
+
+#endif //DATA_STRUCTURES_THREAD_POOL_H
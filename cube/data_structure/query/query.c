@@ -2,45 +2,157 @@
 // Created by regoeco on 18/01/17.
 //
 #include "query.h"
+#include <stdint.h>
+#include <sys/mman.h>
 
 /**
  * 
- * @param size 
+ * @param max_size
+ * @param max_value
+ * @param min_value
+ * @param queryType
  * @return 
  */
-Query *newQuery(int max_size, double max_value, double min_value){
+Query *newQuery(int max_size, double max_value, double min_value, QueryType queryType){
     Query *query = malloc(sizeof(Query));
+    query->queryType = queryType;
+    query->size = 0;
     query->cube = NULL;
+    query->sparse_cube = NULL;
+    query->fenwick = NULL;
+    query->prefix_sum = NULL;
+    query->prefix_sum_dirty = 0;
+    query->stats.num_updates = 0;
+    query->stats.num_sums = 0;
+    query->stats.num_rebuilds = 0;
+    query->kernel = getSumKernel();
+    query->pool = NULL;
+    query->parallel_threshold = 0;
+    query->snapshot = NULL;
+    query->snapshot_length = 0;
     query->max_size = max_size;
     query->max_value = max_value;
     query->min_value = min_value;
-    query->sum = _sum_query;
-    query->update = _update_query;
+    switch (queryType){
+        case FENWICK:
+            query->sum = _sum_fenwick_query;
+            query->update = _update_fenwick_query;
+            break;
+        case PREFIX_SUM:
+            query->sum = _sum_prefix_sum_query;
+            query->update = _update_prefix_sum_query;
+            break;
+        case SPARSE:
+            query->sum = _sum_sparse_query;
+            query->update = _update_sparse_query;
+            break;
+        default:
+            query->sum = _sum_query;
+            query->update = _update_query;
+            break;
+    }
     query->new_cube = _new_cube_query;
+    query->set_parallel = _set_parallel_query;
+    query->check_point = _check_point_query;
+    query->check_box = _check_box_query;
     return query;
 }
 
 /**
  *
+ * @details Unmaps the snapshot the query was loaded from, once nothing
+ * borrows from it anymore.
+ * @param this
+ */
+static void _release_snapshot_query(Query *this){
+    if(this->snapshot != NULL){
+        munmap(this->snapshot, this->snapshot_length);
+        this->snapshot = NULL;
+        this->snapshot_length = 0;
+    }
+}
+
+/**
+ *
+ * @param side
+ * @param cells side^3
+ * @return 0 if side^3 overflows a size_t
+ */
+static int cube_cells(size_t side, size_t *cells){
+    if(side != 0 && (side > SIZE_MAX/side || side*side > SIZE_MAX/side))
+        return 0;
+    *cells = side*side*side;
+    return 1;
+}
+
+/**
+ *
+ * @param this
+ */
+static void _release_cube_query(Query *this){
+    if(this->cube != NULL){
+        destroyCube(this->cube);
+        this->cube = NULL;
+    }
+    if(this->sparse_cube != NULL){
+        destroySparseCube(this->sparse_cube);
+        this->sparse_cube = NULL;
+    }
+    if(this->fenwick != NULL){
+        destroyFenwick(this->fenwick);
+        this->fenwick = NULL;
+    }
+    if(this->prefix_sum != NULL){
+        destroyPrefixSum(this->prefix_sum);
+        this->prefix_sum = NULL;
+    }
+    _release_snapshot_query(this);
+    this->size = 0;
+}
+
+/**
+ *
+ * @details On failure the query is left without a cube.
  * @param this
  * @param size
  * @return
  */
 int _new_cube_query(Query* this, int size){
-    if(size != 0){
-        if(size <= this->max_size){
-            if(this->cube != NULL)
-                destroyCube(this->cube);
-            this->cube = newCube(size);
-            return 1;
-        }else{
-            printf("\nERROR MAX SIZE IS:%d \n" + this->max_size);
-            return 0;
-        }
-    }else{
-        printf("\nERROR MIN SIZE IS: 1\n");
+    size_t cells, table_cells;
+    if(size < 1){
+        fprintf(stderr, "\nERROR MIN SIZE IS: 1\n");
+        return 0;
+    }
+    if(size > this->max_size){
+        fprintf(stderr, "\nERROR MAX SIZE IS:%d \n", this->max_size);
+        return 0;
+    }
+    _release_cube_query(this);
+    //a dense cube counts its cells in an int, the Fenwick tree and the prefix table are (size+1)^3
+    if(!cube_cells((size_t)size, &cells) || !cube_cells((size_t)size + 1, &table_cells) ||
+       (this->queryType != SPARSE && cells > INT_MAX)){
+        fprintf(stderr, "\nERROR CUBE OF SIZE %d IS TOO LARGE\n", size);
+        return 0;
+    }
+    if(this->queryType == SPARSE)
+        this->sparse_cube = newSparseCube(size);
+    else
+        this->cube = newCube(size);
+    if(this->queryType == FENWICK)
+        this->fenwick = newFenwick(size);
+    if(this->queryType == PREFIX_SUM){
+        this->prefix_sum = newPrefixSum(size);
+        this->prefix_sum_dirty = 0;
+    }
+    if((this->queryType == SPARSE ? this->sparse_cube == NULL : this->cube == NULL) ||
+       (this->queryType == FENWICK && this->fenwick == NULL) ||
+       (this->queryType == PREFIX_SUM && this->prefix_sum == NULL)){
+        fprintf(stderr, "\nERROR OUT OF MEMORY FOR A CUBE OF SIZE %d\n", size);
+        _release_cube_query(this);
         return 0;
     }
+    this->size = size;
+    return 1;
 }
 
 /**
@@ -48,56 +160,188 @@ int _new_cube_query(Query* this, int size){
  * @param this 
  */
 void destroyQuery(Query *this){
-    destroyCube(this->cube);
-    free(this->cube);
+    if(this->cube != NULL)
+        destroyCube(this->cube);
+    if(this->sparse_cube != NULL)
+        destroySparseCube(this->sparse_cube);
+    if(this->fenwick != NULL)
+        destroyFenwick(this->fenwick);
+    if(this->prefix_sum != NULL)
+        destroyPrefixSum(this->prefix_sum);
+    if(this->pool != NULL)
+        destroyThreadPool(this->pool);
+    _release_snapshot_query(this);
     free(this);
 }
 
 /**
- * 
- * @param this 
- * @param x 
- * @param y 
- * @param z 
- * @param w
+ *
+ * @param this
+ * @param num_threads
+ * @param threshold
  * @return
  */
-int _update_query(Query *this, int x, int y, int z, int w){
-    printf("%d %d %d %d\n", x, y, z, w);
-    if(this->cube != NULL){
-        int num_elements = this->cube->get_num_elements(this->cube);
-        int limit = this->cube->get_size(this->cube);
+int _set_parallel_query(Query *this, int num_threads, long long threshold){
+    if(this->pool != NULL){
+        destroyThreadPool(this->pool);
+        this->pool = NULL;
+    }
+    this->parallel_threshold = threshold;
+    if(num_threads > 1){
+        //the calling thread works as one more shard
+        this->pool = newThreadPool(num_threads - 1);
+        return this->pool->get_num_threads(this->pool) == num_threads - 1;
+    }
+    return 1;
+}
+
+/**
+ *
+ * @param this
+ * @param x
+ * @param y
+ * @param z
+ * @param w
+ * @return 1 if the cell can be written
+ */
+int _check_point_query(Query *this, int x, int y, int z, int w){
+    if(this->cube != NULL || this->sparse_cube != NULL){
+        int limit = this->size;
         double max_value = this->max_value;
         double min_value = this->min_value;
-        if( num_elements >= 1){
+        if( limit >= 1){
             if(x > limit || x < 1){
-                printf("\nERROR ATTRIBUTE X\n");
+                fprintf(stderr, "\nERROR ATTRIBUTE X\n");
                 return 0;
             }
             if(y > limit || y < 1){
-                printf("\nERROR ATTRIBUTE Y\n");
+                fprintf(stderr, "\nERROR ATTRIBUTE Y\n");
                 return 0;
             }
             if( z > limit || z < 1){
-                printf("\nERROR ATTRIBUTE Z\n");
+                fprintf(stderr, "\nERROR ATTRIBUTE Z\n");
                 return 0;
             }
             if( w >= min_value || w <= max_value){
-                printf("\nERROR ATTRIBUTE W\n");
+                fprintf(stderr, "\nERROR ATTRIBUTE W\n");
                 return 0;
             }
-            int ***cube = this->cube->get_data(this->cube);
-            cube[x-1][y-1][z-1] = w;
             return 1;
         }else{
-            printf("\nERROR SIZE OF CUBE IS: 0\n");
+            fprintf(stderr, "\nERROR SIZE OF CUBE IS: 0\n");
+        }
+    }else{
+        fprintf(stderr, "\nERROR CUBE IS NULL\n");
+    }
+    return 0;
+}
+
+/**
+ *
+ * @param this
+ * @param x1
+ * @param y1
+ * @param z1
+ * @param x2
+ * @param y2
+ * @param z2
+ * @return 1 if the box lies inside the cube
+ */
+int _check_box_query(Query *this, int x1, int y1, int z1, int x2, int y2, int z2){
+    if(this->cube != NULL || this->sparse_cube != NULL){
+        int limit = this->size;
+        if( limit >= 1){
+            if( (1 <= x1 && x1 <= x2 && x2 <= limit) && (1 <= y1 && y1 <= y2 && y2 <= limit) && (1 <= z1 && z1 <= z2 && z2 <= limit) ){
+                return 1;
+            }else{
+                fprintf(stderr, "\nERROR IN ATTRIBUTES\n");
+            }
+        }else{
+            fprintf(stderr, "\nERROR SIZE OF CUBE IS: 0\n");
         }
     }else{
-        printf("\nERROR CUBE IS NULL\n");
+        fprintf(stderr, "\nERROR CUBE IS NULL\n");
+    }
+    return 0;
+}
+
+/**
+ * 
+ * @param this 
+ * @param x 
+ * @param y 
+ * @param z 
+ * @param w
+ * @return
+ */
+int _update_query(Query *this, int x, int y, int z, int w){
+    this->stats.num_updates++;
+    if(_check_point_query(this, x, y, z, w)){
+        this->cube->set(this->cube, x-1, y-1, z-1, w);
+        return 1;
     }
     return 0;
 }
 
+/**
+ *
+ * @details Slab of x planes of a box, summed by one thread of the pool.
+ */
+struct SumShard{
+    Query *query;
+    int x1, y1, z1;
+    int x2, y2, z2;
+    long long sum;
+};
+
+/**
+ *
+ * @param arg
+ * @param index
+ */
+static void _sum_shard_query(void *arg, int index){
+    struct SumShard *shard = (struct SumShard*)arg + index;
+    Cube *cube = shard->query->cube;
+    long long (*const sum_run)(const int*, int) = shard->query->kernel.sum;
+    long long sum = 0;
+    int x, y;
+    for(x = shard->x1; x <= shard->x2; x++)
+        for(y = shard->y1; y <= shard->y2; y++)
+            sum += sum_run(cube->get_row(cube, x-1, y-1) + shard->z1 - 1, shard->z2 - shard->z1 + 1);
+    shard->sum = sum;
+}
+
+/**
+ *
+ * @details Splits the x range of the box in one slab per thread and adds
+ * the partial sums.
+ * @return
+ */
+static long long _parallel_sum_query(Query *this, int x1, int y1, int z1, int x2, int y2, int z2){
+    int num_shards = this->pool->get_num_threads(this->pool) + 1;
+    int planes = x2 - x1 + 1;
+    if(num_shards > planes)
+        num_shards = planes;
+    struct SumShard shards[num_shards];
+    int i, x = x1;
+    for(i = 0; i < num_shards; i++){
+        int width = planes/num_shards + (i < planes%num_shards);
+        shards[i].query = this;
+        shards[i].x1 = x;
+        shards[i].x2 = x + width - 1;
+        shards[i].y1 = y1;
+        shards[i].y2 = y2;
+        shards[i].z1 = z1;
+        shards[i].z2 = z2;
+        x += width;
+    }
+    this->pool->run(this->pool, _sum_shard_query, shards, num_shards);
+    long long sum = 0;
+    for(i = 0; i < num_shards; i++)
+        sum += shards[i].sum;
+    return sum;
+}
+
 /**
  * 
  * @param this 
@@ -110,32 +354,152 @@ int _update_query(Query *this, int x, int y, int z, int w){
  * @return 
  */
 long double  _sum_query(Query *this, int x1, int y1, int z1, int x2, int y2, int z2){
-    printf("%d %d %d %d %d %d\n", x1, y1, z1, x2, y2, z2);
+    this->stats.num_sums++;
 
-    if(this->cube != NULL){
-        int num_elements = this->cube->get_num_elements(this->cube);
-        int limit = this->cube->get_size(this->cube);
-        if( num_elements >= 1){
-            if( (1 <= x1 <= x2 <= limit) && (1 <= y1 <= y2 <= limit) && (1 <= z1 <= z2 <= limit) ){
-                int ***cube = this->cube->get_data(this->cube);
-                long double  sum = 0;
-                int x = 0;
-                int y = 0;
-                int z = 0;
-                for(x = x1; x <= x2; x++)
-                    for(y = y1; y <= y2; y++)
-                        for(z = z1; z <= z2; z++) {
-                            sum += cube[x-1][y-1][z-1];
-                        }
-                return sum;
-            }else{
-                printf("\nERROR IN ATTRIBUTES\n");
+    if(_check_box_query(this, x1, y1, z1, x2, y2, z2)){
+        long long cells = (long long)(x2 - x1 + 1)*(y2 - y1 + 1)*(z2 - z1 + 1);
+        if(this->pool != NULL && x2 > x1 && cells >= this->parallel_threshold)
+            return _parallel_sum_query(this, x1, y1, z1, x2, y2, z2);
+        Cube *cube = this->cube;
+        long long (*const sum_run)(const int*, int) = this->kernel.sum;
+        long long sum = 0;
+        int x = 0;
+        int y = 0;
+        for(x = x1; x <= x2; x++)
+            for(y = y1; y <= y2; y++) {
+                int *row = cube->get_row(cube, x-1, y-1);
+                sum += sum_run(row + z1 - 1, z2 - z1 + 1);
             }
-        }else{
-            printf("\nERROR SIZE OF CUBE IS: 0\n");
+        return sum;
+    }
+    return 0;
+}
+
+/**
+ *
+ * @details The cube keeps the current value of every cell so the tree can
+ * be fed the difference between the old and the new value.
+ * @param this
+ * @param x
+ * @param y
+ * @param z
+ * @param w
+ * @return
+ */
+int _update_fenwick_query(Query *this, int x, int y, int z, int w){
+    this->stats.num_updates++;
+    if(_check_point_query(this, x, y, z, w)){
+        long long delta = (long long)w - this->cube->get(this->cube, x-1, y-1, z-1);
+        this->cube->set(this->cube, x-1, y-1, z-1, w);
+        this->fenwick->update(this->fenwick, x, y, z, delta);
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ *
+ * @details Inclusion-exclusion over the eight prefix boxes of the tree.
+ * @param this
+ * @param x1
+ * @param y1
+ * @param z1
+ * @param x2
+ * @param y2
+ * @param z2
+ * @return
+ */
+long double  _sum_fenwick_query(Query *this, int x1, int y1, int z1, int x2, int y2, int z2){
+    this->stats.num_sums++;
+    if(_check_box_query(this, x1, y1, z1, x2, y2, z2)){
+        Fenwick *f = this->fenwick;
+        x1--; y1--; z1--;
+        long long sum = f->sum(f, x2, y2, z2)
+                        - f->sum(f, x1, y2, z2) - f->sum(f, x2, y1, z2) - f->sum(f, x2, y2, z1)
+                        + f->sum(f, x1, y1, z2) + f->sum(f, x1, y2, z1) + f->sum(f, x2, y1, z1)
+                        - f->sum(f, x1, y1, z1);
+        return sum;
+    }
+    return 0;
+}
+
+/**
+ *
+ * @details Only writes the cube and marks the table stale, the rebuild is
+ * left to the next sum so a run of updates costs a single rebuild.
+ * @param this
+ * @param x
+ * @param y
+ * @param z
+ * @param w
+ * @return
+ */
+int _update_prefix_sum_query(Query *this, int x, int y, int z, int w){
+    this->stats.num_updates++;
+    if(_check_point_query(this, x, y, z, w)){
+        this->cube->set(this->cube, x-1, y-1, z-1, w);
+        this->prefix_sum_dirty = 1;
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ *
+ * @param this
+ * @param x1
+ * @param y1
+ * @param z1
+ * @param x2
+ * @param y2
+ * @param z2
+ * @return
+ */
+long double  _sum_prefix_sum_query(Query *this, int x1, int y1, int z1, int x2, int y2, int z2){
+    this->stats.num_sums++;
+    if(_check_box_query(this, x1, y1, z1, x2, y2, z2)){
+        if(this->prefix_sum_dirty){
+            this->prefix_sum->build(this->prefix_sum, this->cube);
+            this->prefix_sum_dirty = 0;
+            this->stats.num_rebuilds++;
         }
-    }else{
-        printf("\nERROR CUBE IS NULL\n");
+        return this->prefix_sum->sum(this->prefix_sum, x1, y1, z1, x2, y2, z2);
     }
     return 0;
-}
\ No newline at end of file
+}
+
+/**
+ *
+ * @param this
+ * @param x
+ * @param y
+ * @param z
+ * @param w
+ * @return
+ */
+int _update_sparse_query(Query *this, int x, int y, int z, int w){
+    this->stats.num_updates++;
+    if(_check_point_query(this, x, y, z, w)){
+        return this->sparse_cube->set(this->sparse_cube, x-1, y-1, z-1, w);
+    }
+    return 0;
+}
+
+/**
+ *
+ * @param this
+ * @param x1
+ * @param y1
+ * @param z1
+ * @param x2
+ * @param y2
+ * @param z2
+ * @return
+ */
+long double  _sum_sparse_query(Query *this, int x1, int y1, int z1, int x2, int y2, int z2){
+    this->stats.num_sums++;
+    if(_check_box_query(this, x1, y1, z1, x2, y2, z2)){
+        return this->sparse_cube->sum(this->sparse_cube, x1-1, y1-1, z1-1, x2-1, y2-1, z2-1);
+    }
+    return 0;
+}
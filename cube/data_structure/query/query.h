@@ -7,27 +7,62 @@
 
 #include <malloc.h>
 #include "../ADT/cube.h"
+#include "../ADT/fenwick.h"
+#include "../ADT/prefix_sum.h"
+#include "../ADT/sparse_cube.h"
+#include "../kernel/sum_kernel.h"
+#include "../pool/thread_pool.h"
+
+/**
+ * NAIVE walks every cell of the box on each sum, FENWICK keeps a binary
+ * indexed tree next to the cube so update and sum are O(log^3 N),
+ * PREFIX_SUM answers sum in O(1) from a summed-area table that is rebuilt
+ * in O(N^3) on the first sum after an update. SPARSE has no dense cube at
+ * all, it hashes the written cells so memory follows the number of updates.
+ */
+typedef enum QueryType{ NAIVE, FENWICK, PREFIX_SUM, SPARSE }QueryType;
+
+typedef struct QueryStats{
+    unsigned long num_updates;
+    unsigned long num_sums;
+    unsigned long num_rebuilds;//PREFIX_SUM only
+}QueryStats;
 
 typedef struct Query Query;
 struct Query{
+    QueryType queryType;
+    int size;
     Cube* cube;
+    SparseCube* sparse_cube;
+    Fenwick* fenwick;
+    PrefixSum* prefix_sum;
+    int prefix_sum_dirty;
+    QueryStats stats;
+    SumKernel kernel;//z-run summation used by NAIVE
+    ThreadPool* pool;//NULL keeps NAIVE sums on the calling thread
+    long long parallel_threshold;//cells of a box below which NAIVE stays serial
+    void* snapshot;//mapping the structures above borrow from, see snapshot.h
+    size_t snapshot_length;
     int max_size;
     double max_value;
     double min_value;
     int (*update)(Query *this, int x, int y, int z, int w);
     long double  (*sum)(Query *this, int x1, int y1, int z1, int x2, int y2, int z2);
     int (*new_cube)(Query *this, int size);
+    int (*set_parallel)(Query *this, int num_threads, long long threshold);
+    int (*check_point)(Query *this, int x, int y, int z, int w);
+    int (*check_box)(Query *this, int x1, int y1, int z1, int x2, int y2, int z2);
 };
 
 /**
  *
- * @param size_data
  * @param max_size
  * @param max_value
  * @param min_value
+ * @param queryType
  * @return
  */
-Query *newQuery(int max_size, double max_value, double min_value);
+Query *newQuery(int max_size, double max_value, double min_value, QueryType queryType);
 
 /**
  *
@@ -58,6 +93,75 @@ static int _update_query(Query *this, int x, int y, int z, int w);
  */
 static  long double  _sum_query(Query *this, int x1, int y1, int z1, int x2, int y2, int z2);
 
+/**
+ *
+ * @param this
+ * @param x
+ * @param y
+ * @param z
+ * @param w
+ */
+static int _update_fenwick_query(Query *this, int x, int y, int z, int w);
+
+/**
+ *
+ * @param this
+ * @param x1
+ * @param y1
+ * @param z1
+ * @param x2
+ * @param y2
+ * @param z2
+ * @return
+ */
+static  long double  _sum_fenwick_query(Query *this, int x1, int y1, int z1, int x2, int y2, int z2);
+
+/**
+ *
+ * @param this
+ * @param x
+ * @param y
+ * @param z
+ * @param w
+ */
+static int _update_prefix_sum_query(Query *this, int x, int y, int z, int w);
+
+/**
+ *
+ * @param this
+ * @param x1
+ * @param y1
+ * @param z1
+ * @param x2
+ * @param y2
+ * @param z2
+ * @return
+ */
+static  long double  _sum_prefix_sum_query(Query *this, int x1, int y1, int z1, int x2, int y2, int z2);
+
+/**
+ *
+ * @param this
+ * @param x
+ * @param y
+ * @param z
+ * @param w
+ */
+static int _update_sparse_query(Query *this, int x, int y, int z, int w);
+
+/**
+ *
+ * @param this
+ * @param x1
+ * @param y1
+ * @param z1
+ * @param x2
+ * @param y2
+ * @param z2
+ * @return
+ */
+static  long double  _sum_sparse_query(Query *this, int x1, int y1, int z1, int x2, int y2, int z2);
+
 /**
  *
  * @param this
@@ -65,5 +169,38 @@ static  long double  _sum_query(Query *this, int x1, int y1, int z1, int x2, int
  */
 int _new_cube_query(Query *this, int size);
 
+/**
+ *
+ * @param this
+ * @param num_threads threads summing a box, 1 or less turns it off
+ * @param threshold
+ * @return
+ */
+static int _set_parallel_query(Query *this, int num_threads, long long threshold);
+
+/**
+ *
+ * @param this
+ * @param x
+ * @param y
+ * @param z
+ * @param w
+ * @return 1 if update would accept the cell
+ */
+static int _check_point_query(Query *this, int x, int y, int z, int w);
+
+/**
+ *
+ * @param this
+ * @param x1
+ * @param y1
+ * @param z1
+ * @param x2
+ * @param y2
+ * @param z2
+ * @return 1 if sum would accept the box
+ */
+static int _check_box_query(Query *this, int x1, int y1, int z1, int x2, int y2, int z2);
+
 
 #endif //DATA_STRUCTURES_QUERY_MANAGER_H
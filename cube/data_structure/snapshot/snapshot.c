@@ -0,0 +1,183 @@
+//
+// Created by regoeco on 18/01/17.
+//
+#include "snapshot.h"
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/**
+ *
+ * @param offset
+ * @return
+ */
+static unsigned long long align(unsigned long long offset){
+    return (offset + SNAPSHOT_ALIGNMENT - 1) & ~(unsigned long long)(SNAPSHOT_ALIGNMENT - 1);
+}
+
+/**
+ *
+ * @param section
+ * @param offset end of the previous section, moved past this one
+ * @param length
+ */
+static void place(SnapshotSection *section, unsigned long long *offset, unsigned long long length){
+    section->offset = length > 0 ? align(*offset) : 0;
+    section->length = length;
+    if(length > 0)
+        *offset = section->offset + length;
+}
+
+/**
+ *
+ * @param file
+ * @param section
+ * @param data
+ * @return
+ */
+static int write_section(FILE *file, const SnapshotSection *section, const void *data){
+    static const char zeros[SNAPSHOT_ALIGNMENT] = { 0 };
+    if(section->length == 0)
+        return 1;
+    long position = ftell(file);
+    if(position < 0 || (unsigned long long)position > section->offset)
+        return 0;
+    if(fwrite(zeros, 1, section->offset - (unsigned long long)position, file) != section->offset - (unsigned long long)position)
+        return 0;
+    return fwrite(data, 1, section->length, file) == section->length;
+}
+
+/**
+ *
+ * @param query
+ * @param path
+ * @return
+ */
+int saveSnapshot(Query *query, const char *path){
+    SnapshotHeader header;
+    unsigned long long offset = sizeof(SnapshotHeader);
+    unsigned long long side = (unsigned long long)query->size + 1;
+    unsigned long long table = side*side*side*sizeof(long long);
+
+    if(query->cube == NULL && query->sparse_cube == NULL){
+        fprintf(stderr, "\nERROR CUBE IS NULL\n");
+        return 0;
+    }
+    if(query->prefix_sum != NULL && query->prefix_sum_dirty){
+        query->prefix_sum->build(query->prefix_sum, query->cube);
+        query->prefix_sum_dirty = 0;
+        query->stats.num_rebuilds++;
+    }
+
+    memset(&header, 0, sizeof(SnapshotHeader));
+    memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version = SNAPSHOT_VERSION;
+    header.byte_order = SNAPSHOT_BYTE_ORDER;
+    header.queryType = query->queryType;
+    header.size = query->size;
+    place(&header.cube, &offset, query->cube != NULL ? CUBE_INDEX(query->size, query->size, 0, 0)*sizeof(int) : 0);
+    place(&header.fenwick, &offset, query->fenwick != NULL ? table : 0);
+    place(&header.prefix_sum, &offset, query->prefix_sum != NULL ? table : 0);
+    if(query->sparse_cube != NULL){
+        header.sparse_capacity = query->sparse_cube->capacity;
+        header.sparse_num_elements = query->sparse_cube->num_elements;
+        place(&header.sparse_cube, &offset, (unsigned long long)query->sparse_cube->capacity*sizeof(SparseCell));
+    }
+
+    FILE *file = fopen(path, "wb");
+    if(file == NULL){
+        fprintf(stderr, "\nERROR OPENING %s\n", path);
+        return 0;
+    }
+    int ok = fwrite(&header, sizeof(SnapshotHeader), 1, file) == 1;
+    ok = ok && write_section(file, &header.cube, query->cube != NULL ? query->cube->data : NULL);
+    ok = ok && write_section(file, &header.fenwick, query->fenwick != NULL ? query->fenwick->tree : NULL);
+    ok = ok && write_section(file, &header.prefix_sum, query->prefix_sum != NULL ? query->prefix_sum->table : NULL);
+    ok = ok && write_section(file, &header.sparse_cube, query->sparse_cube != NULL ? query->sparse_cube->cells : NULL);
+    ok = (fclose(file) == 0) && ok;
+    if(!ok)
+        fprintf(stderr, "\nERROR WRITING %s\n", path);
+    return ok;
+}
+
+/**
+ *
+ * @param section
+ * @param length expected length, 0 if the section must be absent
+ * @param file_length
+ * @return
+ */
+static int check_section(const SnapshotSection *section, unsigned long long length, unsigned long long file_length){
+    if(section->length != length)
+        return 0;
+    if(length == 0)
+        return 1;
+    return section->offset % SNAPSHOT_ALIGNMENT == 0 && section->offset <= file_length && length <= file_length - section->offset;
+}
+
+/**
+ *
+ * @param path
+ * @param max_size
+ * @param max_value
+ * @param min_value
+ * @return
+ */
+Query *loadSnapshot(const char *path, int max_size, double max_value, double min_value){
+    struct stat st;
+    int fd = open(path, O_RDONLY);
+    if(fd < 0){
+        fprintf(stderr, "\nERROR OPENING %s\n", path);
+        return NULL;
+    }
+    if(fstat(fd, &st) != 0 || (unsigned long long)st.st_size < sizeof(SnapshotHeader)){
+        fprintf(stderr, "\nERROR SNAPSHOT %s IS TRUNCATED\n", path);
+        close(fd);
+        return NULL;
+    }
+    size_t length = (size_t)st.st_size;
+    char *base = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(base == MAP_FAILED){
+        fprintf(stderr, "\nERROR MAPPING %s\n", path);
+        return NULL;
+    }
+
+    const SnapshotHeader *header = (const SnapshotHeader*)base;
+    unsigned long long side = (unsigned long long)header->size + 1;
+    unsigned long long table = side*side*side*sizeof(long long);
+    QueryType queryType = (QueryType)header->queryType;
+    int valid = memcmp(header->magic, SNAPSHOT_MAGIC, sizeof(header->magic)) == 0 &&
+                header->version == SNAPSHOT_VERSION && header->byte_order == SNAPSHOT_BYTE_ORDER &&
+                header->queryType <= SPARSE && header->size >= 1 && header->size <= max_size;
+    valid = valid && check_section(&header->cube, queryType != SPARSE ? CUBE_INDEX(header->size, header->size, 0, 0)*sizeof(int) : 0, length);
+    valid = valid && check_section(&header->fenwick, queryType == FENWICK ? table : 0, length);
+    valid = valid && check_section(&header->prefix_sum, queryType == PREFIX_SUM ? table : 0, length);
+    valid = valid && (queryType != SPARSE || (header->sparse_capacity >= SPARSE_CUBE_MIN_CAPACITY &&
+                                              (header->sparse_capacity & (header->sparse_capacity - 1)) == 0 &&
+                                              header->sparse_num_elements < header->sparse_capacity));
+    valid = valid && check_section(&header->sparse_cube, queryType == SPARSE ? (unsigned long long)header->sparse_capacity*sizeof(SparseCell) : 0, length);
+    if(!valid){
+        fprintf(stderr, "\nERROR %s IS NOT A VALID SNAPSHOT\n", path);
+        munmap(base, length);
+        return NULL;
+    }
+
+    Query *query = newQuery(max_size, max_value, min_value, queryType);
+    query->size = header->size;
+    if(header->cube.length > 0)
+        query->cube = newCubeFrom(header->size, (int*)(base + header->cube.offset));
+    if(header->fenwick.length > 0)
+        query->fenwick = newFenwickFrom(header->size, (long long*)(base + header->fenwick.offset));
+    if(header->prefix_sum.length > 0)
+        query->prefix_sum = newPrefixSumFrom(header->size, (long long*)(base + header->prefix_sum.offset));
+    if(header->sparse_cube.length > 0)
+        query->sparse_cube = newSparseCubeFrom(header->size, (SparseCell*)(base + header->sparse_cube.offset),
+                                               header->sparse_capacity, header->sparse_num_elements);
+    query->snapshot = base;
+    query->snapshot_length = length;
+    return query;
+}
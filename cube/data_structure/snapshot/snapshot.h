@@ -0,0 +1,62 @@
+//
+// Created by regoeco on 18/01/17.
+//
+
+#ifndef DATA_STRUCTURES_SNAPSHOT_H
+#define DATA_STRUCTURES_SNAPSHOT_H
+
+#include "../query/query.h"
+
+#define SNAPSHOT_MAGIC "CUBESNAP"
+#define SNAPSHOT_VERSION 1
+#define SNAPSHOT_BYTE_ORDER 0x01020304u
+#define SNAPSHOT_ALIGNMENT 64
+
+/**
+ * Binary image of a Query: a fixed header followed by one section per
+ * structure the query mode uses (cube cells, Fenwick tree, prefix-sum table
+ * or sparse cells), each at a SNAPSHOT_ALIGNMENT offset and stored exactly
+ * as it is in memory. Loading maps the file and points the structures at
+ * their sections, nothing is parsed or copied.
+ */
+typedef struct SnapshotSection{
+    unsigned long long offset;
+    unsigned long long length;//0 if the mode does not use it
+}SnapshotSection;
+
+typedef struct SnapshotHeader{
+    char magic[8];
+    unsigned int version;
+    unsigned int byte_order;
+    unsigned int queryType;
+    int size;
+    unsigned int sparse_capacity;
+    unsigned int sparse_num_elements;
+    SnapshotSection cube;
+    SnapshotSection fenwick;
+    SnapshotSection prefix_sum;
+    SnapshotSection sparse_cube;
+}SnapshotHeader;
+
+/**
+ *
+ * @details A stale prefix-sum table is rebuilt before it is written.
+ * @param query
+ * @param path
+ * @return
+ */
+int saveSnapshot(Query *query, const char *path);
+
+/**
+ *
+ * @details The file is mapped private: sums read it in place and updates
+ * only copy the pages they touch, the file itself is never written.
+ * @param path
+ * @param max_size
+ * @param max_value
+ * @param min_value
+ * @return NULL if the file is not a valid snapshot
+ */
+Query *loadSnapshot(const char *path, int max_size, double max_value, double min_value);
+
+#endif //DATA_STRUCTURES_SNAPSHOT_H
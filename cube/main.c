@@ -3,121 +3,102 @@
 //
 #include <stdio.h>
 #include "cube_summation.h"
+#include "batch.h"
+#include "data_structure/snapshot/snapshot.h"
 #include <string.h>
 #include <stdlib.h>
 #include <math.h>
+#include <unistd.h>
 
-char **readLine(char* string);
-int main(){
-    printf("TEST\n");
-    int T;//1 <= T <= 50 TEST
-    int N;//1 <= N <= 100 SIZE CUBE
-    int M; // 1 <= M <= 1000 QUERYS
-    int W; // -10^9 <= W <= 10^9
-    int i = 0 , j= 0;
-    char *p[] = {
-            "UPDATE 2 2 2 1",
-            "QUERY 1 1 1 1 1 1",
-            "QUERY 1 1 1 2 2 2",
-            "QUERY 2 2 2 2 2 2"
-    };
-    CubeSummation *cubeSummation = newCubeSummation(100, pow(-10, 9), pow(10, 9));
-    CubeSummation* this = cubeSummation;
-
-    char **res;
-    long double sum;
-    T = 1;
-    if(1 <= T && T <= 50) {
-        for (i = 0; i < T; i++) {
-            N = 2;//read
-            M = 4;
-            if (1 <= N && N <= 100) {
-                cubeSummation->execute->new_cube(this->execute, N);
-                if (1 <= M && M <= 1000) {
-                    for (j = 0; j < M; j++) {
-                        res = readLine(p[j]);
-                        if (res != NULL) {
-                            printf("%s\n", p[j]);
-                            if (!strcmp("QUERY", res[0])) {
-                               // printf("%s %s %s %s %s %s %s\n", res[0], res[1], res[2], res[3], res[4], res[5], res[6]);
-                                sum = cubeSummation->execute->sum(this->execute, atoi(res[1]), atoi(res[2]),atoi(res[3]), atoi(res[4]), atoi(res[5]),atoi(res[6]));
-                               printf("Sum: %Lf\n", sum);
-                            } else if (!strcmp("UPDATE", res[0])) {
-                                //printf("%s %s %s %s %s\n", res[0], res[1], res[2], res[3], res[4]);
-                                cubeSummation->execute->update(this->execute, atoi(res[1]), atoi(res[2]), atoi(res[3]), atoi(res[4]));
-                            }
-                        } else printf("\nERROR GETTING LINE\n");
-                    }
-                } else printf("\nERROR IN SIZE OF QUERYS\n");
-            } else printf("\nERROR IN SIZE OF CUBE\n");
-        }
-    }else printf("\nERROR IN SIZE OF TEST\n");
-
-
-    return EXIT_SUCCESS;
-}
-
-char **readLine(char* string){
-    int len = (int)strlen(string);
-    int i = 0;
-    int pos = 0;
-    char c;
-    char inst[7];
-    for(i=0; i<len; i++){
-        c = string[i];
-        if(c == ' '){
-            inst[pos] = '\0';
-            break;
-        }else{
-            inst[pos++] = c;
+/**
+ * usage: data_structures [-m naive|fenwick|prefix|sparse] [-n max_size] [-k] [-o]
+ *                        [-l snapshot] [-s snapshot] [file]
+ *
+ * Runs the CubeSummation test cases read from file, or stdin, and prints the
+ * result of every QUERY. -k prints the sum kernel in use on stderr, -o
+ * answers each test case offline once all of its commands are read. -l
+ * starts from a snapshot, in the mode it was saved with, and the first test
+ * case goes on with its cube when N matches; -s saves the cube of the last
+ * test case run online.
+ */
+int main(int argc, char** argv){
+    QueryType queryType = FENWICK;
+    int max_size = 100;// 1 <= N <= 100 SIZE CUBE
+    int print_kernel = 0;
+    int offline = 0;
+    const char *load = NULL;
+    const char *save = NULL;
+    int opt;
+    while((opt = getopt(argc, argv, "m:n:kol:s:")) != -1){
+        switch (opt){
+            case 'm':
+                if(!strcmp("naive", optarg))
+                    queryType = NAIVE;
+                else if(!strcmp("fenwick", optarg))
+                    queryType = FENWICK;
+                else if(!strcmp("prefix", optarg))
+                    queryType = PREFIX_SUM;
+                else if(!strcmp("sparse", optarg))
+                    queryType = SPARSE;
+                else{
+                    fprintf(stderr, "\nERROR UNKNOWN MODE: %s\n", optarg);
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 'n':
+                max_size = atoi(optarg);
+                break;
+            case 'k':
+                print_kernel = 1;
+                break;
+            case 'o':
+                offline = 1;
+                break;
+            case 'l':
+                load = optarg;
+                break;
+            case 's':
+                save = optarg;
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-m naive|fenwick|prefix|sparse] [-n max_size] [-k] [-o] [-l snapshot] [-s snapshot] [file]\n", argv[0]);
+                return EXIT_FAILURE;
         }
     }
-    if(!strcmp("UPDATE", inst)){
-        static char* values[5];//x, y, z, w;
-        int v = 0;
-        char *str_value = malloc(sizeof(char));
-        values[v++] = "UPDATE";
 
-        for(i += 1; i<=len; i++){
-            c = string[i];
-            if(c == ' ' || i == len){
-                char* c_new =  malloc(sizeof(char*));
-                memcpy(c_new, str_value, strlen(str_value));
-                values[v++] = c_new;
-                strcpy(str_value, "");
-            }else{
-                char* c_new =  malloc(sizeof(char));
-                memcpy(c_new, &c, 1);
-                strcat(str_value, c_new);
-            }
+    FILE *in = stdin;
+    if(optind < argc){
+        in = fopen(argv[optind], "rb");
+        if(in == NULL){
+            fprintf(stderr, "\nERROR OPENING %s\n", argv[optind]);
+            return EXIT_FAILURE;
         }
-        //free(str_value);
-        return values;
-
-    }else if(!strcmp("QUERY", inst)){
-        static char* values[7];//x1, y1, z1, x2, y2, z2;
-        int v = 0;
-        char *str_value = malloc(sizeof(char));
-        values[v++] = "QUERY";
+    }
 
-        for(i += 1; i<=len; i++){
-            c = string[i];
-            if(c == ' ' || i == len ){
-                char* c_new =  malloc(sizeof(char*));
-                memcpy(c_new, str_value, strlen(str_value));
-                values[v++] = c_new;
-                strcpy(str_value, "");
-            }else{
-                char* c_new =  malloc(sizeof(char));
-                memcpy(c_new, &c, 1);
-                strcat(str_value, c_new);
-            }
+    // -10^9 <= W <= 10^9
+    CubeSummation *cubeSummation = newCubeSummation(max_size, pow(-10, 9), pow(10, 9), queryType);
+    if(load != NULL){
+        Query *query = loadSnapshot(load, max_size, pow(-10, 9), pow(10, 9));
+        if(query == NULL){
+            destroyCubeSummation(cubeSummation);
+            if(in != stdin)
+                fclose(in);
+            return EXIT_FAILURE;
         }
-        //free(str_value);
-        return values;
-
-    }else{
-        return NULL;
+        destroyQuery(cubeSummation->execute);
+        cubeSummation->execute = query;
     }
-    return NULL;
-}
\ No newline at end of file
+    if(print_kernel)
+        fprintf(stderr, "Kernel: %s\n", cubeSummation->execute->kernel.name);
+    Batch *batch = newBatch(cubeSummation, in, stdout, offline);
+    batch->warm = load != NULL;
+    int ok = batch->run(batch);
+    if(ok && save != NULL)
+        ok = saveSnapshot(cubeSummation->execute, save);
+
+    destroyBatch(batch);
+    destroyCubeSummation(cubeSummation);
+    if(in != stdin)
+        fclose(in);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,303 @@
+//
+// Created by regoeco on 18/01/17.
+//
+#include "offline.h"
+
+/**
+ *
+ * @param query
+ * @return
+ */
+Offline *newOffline(Query *query){
+    Offline *offline = malloc(sizeof(Offline));
+    offline->query = query;
+    offline->size = 0;
+    offline->values = NULL;
+    offline->events = NULL;
+    offline->buffer = NULL;
+    offline->num_events = 0;
+    offline->capacity_events = 0;
+    offline->answers = NULL;
+    offline->num_answers = 0;
+    offline->capacity_answers = 0;
+    offline->tree = NULL;
+    offline->reset = _reset_offline;
+    offline->update = _update_offline;
+    offline->sum = _sum_offline;
+    offline->solve = _solve_offline;
+    return offline;
+}
+
+/**
+ *
+ * @param this
+ */
+void destroyOffline(Offline *this){
+    if(this->values != NULL)
+        destroySparseCube(this->values);
+    free(this->events);
+    free(this->buffer);
+    free(this->answers);
+    free(this->tree);
+    free(this);
+}
+
+/**
+ *
+ * @param this
+ * @param size
+ * @return
+ */
+int _reset_offline(Offline *this, int size){
+    if(size < 1){
+        fprintf(stderr, "\nERROR MIN SIZE IS: 1\n");
+        return 0;
+    }
+    if(size > this->query->max_size || size > OFFLINE_MAX_SIZE){
+        fprintf(stderr, "\nERROR OFFLINE MAX SIZE IS:%d \n",
+                this->query->max_size < OFFLINE_MAX_SIZE ? this->query->max_size : OFFLINE_MAX_SIZE);
+        return 0;
+    }
+    if(this->values != NULL)
+        destroySparseCube(this->values);
+    this->values = newSparseCube(size);
+    free(this->tree);
+    this->tree = calloc(((size_t)size + 1)*((size_t)size + 1), sizeof(long long));
+    if(this->tree == NULL){
+        fprintf(stderr, "\nERROR OUT OF MEMORY FOR A CUBE OF SIZE %d\n", size);
+        this->size = 0;
+        return 0;
+    }
+    this->size = size;
+    this->num_events = 0;
+    this->num_answers = 0;
+    return 1;
+}
+
+/**
+ *
+ * @param this
+ * @param x
+ * @param y
+ * @param z
+ * @param id
+ * @param value
+ * @return
+ */
+static int push_event(Offline *this, int x, int y, int z, int id, long long value){
+    if(this->num_events == this->capacity_events){
+        size_t capacity = this->capacity_events > 0 ? this->capacity_events*2 : 1024;
+        OfflineEvent *events = realloc(this->events, capacity*sizeof(OfflineEvent));
+        if(events == NULL)
+            return 0;
+        this->events = events;
+        this->capacity_events = capacity;
+    }
+    OfflineEvent *e = &this->events[this->num_events++];
+    e->x = x;
+    e->y = y;
+    e->z = z;
+    e->id = id;
+    e->value = value;
+    return 1;
+}
+
+/**
+ *
+ * @details Same rules as check_point of Query, against the size of the
+ * test case instead of a cube.
+ * @param this
+ * @param x
+ * @param y
+ * @param z
+ * @param w
+ * @return 1 if the cell can be written
+ */
+static int check_point(Offline *this, int x, int y, int z, int w){
+    if(this->size < 1){
+        fprintf(stderr, "\nERROR SIZE OF CUBE IS: 0\n");
+        return 0;
+    }
+    if(x > this->size || x < 1){
+        fprintf(stderr, "\nERROR ATTRIBUTE X\n");
+        return 0;
+    }
+    if(y > this->size || y < 1){
+        fprintf(stderr, "\nERROR ATTRIBUTE Y\n");
+        return 0;
+    }
+    if(z > this->size || z < 1){
+        fprintf(stderr, "\nERROR ATTRIBUTE Z\n");
+        return 0;
+    }
+    if(w >= this->query->min_value || w <= this->query->max_value){
+        fprintf(stderr, "\nERROR ATTRIBUTE W\n");
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ *
+ * @param this
+ * @param x1
+ * @param y1
+ * @param z1
+ * @param x2
+ * @param y2
+ * @param z2
+ * @return 1 if the box lies inside the cube
+ */
+static int check_box(Offline *this, int x1, int y1, int z1, int x2, int y2, int z2){
+    int limit = this->size;
+    if(limit < 1){
+        fprintf(stderr, "\nERROR SIZE OF CUBE IS: 0\n");
+        return 0;
+    }
+    if( (1 <= x1 && x1 <= x2 && x2 <= limit) && (1 <= y1 && y1 <= y2 && y2 <= limit) && (1 <= z1 && z1 <= z2 && z2 <= limit) )
+        return 1;
+    fprintf(stderr, "\nERROR IN ATTRIBUTES\n");
+    return 0;
+}
+
+/**
+ *
+ * @param this
+ * @param x
+ * @param y
+ * @param z
+ * @param w
+ * @return
+ */
+int _update_offline(Offline *this, int x, int y, int z, int w){
+    if(!check_point(this, x, y, z, w))
+        return 0;
+    long long delta = (long long)w - this->values->get(this->values, x-1, y-1, z-1);
+    if(delta == 0)
+        return 1;
+    this->values->set(this->values, x-1, y-1, z-1, w);
+    return push_event(this, x, y, z, -1, delta);
+}
+
+/**
+ *
+ * @param this
+ * @param x1
+ * @param y1
+ * @param z1
+ * @param x2
+ * @param y2
+ * @param z2
+ * @return
+ */
+int _sum_offline(Offline *this, int x1, int y1, int z1, int x2, int y2, int z2){
+    if(this->num_answers == this->capacity_answers){
+        unsigned int capacity = this->capacity_answers > 0 ? this->capacity_answers*2 : 1024;
+        long long *answers = realloc(this->answers, capacity*sizeof(long long));
+        if(answers == NULL)
+            return 0;
+        this->answers = answers;
+        this->capacity_answers = capacity;
+    }
+    int id = (int)this->num_answers++;
+    this->answers[id] = 0;
+    if(!check_box(this, x1, y1, z1, x2, y2, z2))
+        return 0;
+    //corner i takes the low side of every axis whose bit is set
+    int corner;
+    for(corner = 0; corner < 8; corner++){
+        int x = corner & 1 ? x1 - 1 : x2;
+        int y = corner & 2 ? y1 - 1 : y2;
+        int z = corner & 4 ? z1 - 1 : z2;
+        if(x == 0 || y == 0 || z == 0)
+            continue;
+        long long sign = __builtin_parity(corner) ? -1 : 1;
+        if(!push_event(this, x, y, z, id, sign))
+            return 0;
+    }
+    return 1;
+}
+
+/**
+ *
+ * @param this
+ * @param y
+ * @param z
+ * @param delta
+ */
+static void tree_add(Offline *this, int y, int z, long long delta){
+    size_t side = (size_t)this->size + 1;
+    int i, j;
+    for(i = y; i <= this->size; i += i & -i)
+        for(j = z; j <= this->size; j += j & -j)
+            this->tree[(size_t)i*side + j] += delta;
+}
+
+/**
+ *
+ * @param this
+ * @param y
+ * @param z
+ * @return
+ */
+static long long tree_sum(Offline *this, int y, int z){
+    size_t side = (size_t)this->size + 1;
+    long long sum = 0;
+    int i, j;
+    for(i = y; i > 0; i -= i & -i)
+        for(j = z; j > 0; j -= j & -j)
+            sum += this->tree[(size_t)i*side + j];
+    return sum;
+}
+
+/**
+ *
+ * @details On return events[lo, hi) is sorted by x and every query in it has
+ * received the updates of the range that precede it in time.
+ * @param this
+ * @param lo
+ * @param hi
+ */
+static void cdq(Offline *this, size_t lo, size_t hi){
+    if(hi - lo <= 1)
+        return;
+    size_t mid = lo + (hi - lo)/2;
+    cdq(this, lo, mid);
+    cdq(this, mid, hi);
+
+    OfflineEvent *e = this->events;
+    OfflineEvent *out = this->buffer + lo;
+    size_t i = lo, j = mid, k;
+    while(j < hi){
+        //updates of the left half at the same x come first
+        while(i < mid && e[i].x <= e[j].x){
+            if(e[i].id < 0)
+                tree_add(this, e[i].y, e[i].z, e[i].value);
+            *out++ = e[i++];
+        }
+        if(e[j].id >= 0)
+            this->answers[e[j].id] += e[j].value*tree_sum(this, e[j].y, e[j].z);
+        *out++ = e[j++];
+    }
+    for(k = lo; k < i; k++)
+        if(e[k].id < 0)
+            tree_add(this, e[k].y, e[k].z, -e[k].value);
+    while(i < mid)
+        *out++ = e[i++];
+    memcpy(e + lo, this->buffer + lo, (hi - lo)*sizeof(OfflineEvent));
+}
+
+/**
+ *
+ * @param this
+ * @return
+ */
+long long* _solve_offline(Offline *this){
+    if(this->num_events > 0){
+        free(this->buffer);
+        this->buffer = malloc(this->num_events*sizeof(OfflineEvent));
+        cdq(this, 0, this->num_events);
+        this->num_events = 0;
+    }
+    return this->answers;
+}
@@ -0,0 +1,107 @@
+//
+// Created by regoeco on 18/01/17.
+//
+
+#ifndef DATA_STRUCTURES_OFFLINE_H
+#define DATA_STRUCTURES_OFFLINE_H
+#include <malloc.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cube_summation.h"
+
+/**
+ * Largest cube side the offline solver accepts, its 2D tree is
+ * (size+1)^2 long longs.
+ */
+#define OFFLINE_MAX_SIZE 4096
+
+/**
+ * Answers a whole test case at once. Updates become point deltas and every
+ * query the signed sum of up to eight prefix boxes; a CDQ divide and
+ * conquer over time, merging by x and keeping (y, z) in a 2D Fenwick tree,
+ * adds each delta to the prefix boxes that come after it. Work is
+ * O(E log E log^2 N) for E events and memory O(E + N^2), no N^3 structure.
+ */
+typedef struct OfflineEvent{
+    int x;
+    int y;
+    int z;
+    int id;//index of the answer, -1 for an update
+    long long value;//delta of an update, sign of a query
+}OfflineEvent;
+
+typedef struct Offline Offline;
+struct Offline{
+    Query *query;//limits of the size and the values, its cube is never used
+    int size;//of the test case
+    SparseCube *values;//current value of every written cell
+    OfflineEvent *events;
+    OfflineEvent *buffer;
+    size_t num_events;
+    size_t capacity_events;
+    long long *answers;
+    unsigned int num_answers;
+    unsigned int capacity_answers;
+    long long *tree;//(size+1)*(size+1)
+    int (*reset)(Offline *this, int size);
+    int (*update)(Offline *this, int x, int y, int z, int w);
+    int (*sum)(Offline *this, int x1, int y1, int z1, int x2, int y2, int z2);
+    long long* (*solve)(Offline *this);
+};
+
+/**
+ *
+ * @param query
+ * @return
+ */
+Offline *newOffline(Query *query);
+
+/**
+ *
+ * @param this
+ */
+void destroyOffline(Offline *this);
+
+/**
+ *
+ * @details Starts a new test case, nothing of size^3 is allocated.
+ * @param this
+ * @param size
+ * @return
+ */
+static int _reset_offline(Offline *this, int size);
+
+/**
+ *
+ * @param this
+ * @param x
+ * @param y
+ * @param z
+ * @param w
+ * @return
+ */
+static int _update_offline(Offline *this, int x, int y, int z, int w);
+
+/**
+ *
+ * @details Records a query, its answer is left at the same index of the
+ * array solve() returns.
+ * @param this
+ * @param x1
+ * @param y1
+ * @param z1
+ * @param x2
+ * @param y2
+ * @param z2
+ * @return
+ */
+static int _sum_offline(Offline *this, int x1, int y1, int z1, int x2, int y2, int z2);
+
+/**
+ *
+ * @param this
+ * @return one answer per recorded query, in order
+ */
+static long long* _solve_offline(Offline *this);
+
+#endif //DATA_STRUCTURES_OFFLINE_H
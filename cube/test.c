@@ -0,0 +1,278 @@
+//
+// Created by regoeco on 18/01/17.
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "cube_summation.h"
+#include "offline.h"
+#include "data_structure/snapshot/snapshot.h"
+
+/**
+ * usage: cube_test [-s seed]
+ *
+ * Replays random UPDATE/QUERY traces against every Query mode and the
+ * offline solver, checking each sum against NAIVE. A quarter of the
+ * coordinates are drawn from the borders 1 and N. Every mode is also saved
+ * to a snapshot and loaded back, the loaded query must agree with NAIVE
+ * before and after more updates. Exits with failure on any mismatch.
+ */
+#define TEST_COMMANDS 2000
+
+static const int sizes[] = { 1, 2, 3, 8, 17 };
+
+/**
+ *
+ * @param state
+ * @return
+ */
+static unsigned long long next_random(unsigned long long *state){
+    unsigned long long x = *state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *state = x;
+    return x*0x2545F4914F6CDD1DULL;
+}
+
+/**
+ *
+ * @param state
+ * @param lo
+ * @param hi
+ * @return uniform in [lo, hi]
+ */
+static int random_between(unsigned long long *state, int lo, int hi){
+    return lo + (int)(next_random(state)%(unsigned long long)(hi - lo + 1));
+}
+
+/**
+ *
+ * @param state
+ * @param size
+ * @return 1 or size once in four, any coordinate otherwise
+ */
+static int random_coordinate(unsigned long long *state, int size){
+    switch (next_random(state)%8){
+        case 0:
+            return 1;
+        case 1:
+            return size;
+        default:
+            return random_between(state, 1, size);
+    }
+}
+
+/**
+ *
+ * @param state
+ * @param size
+ * @param lo
+ * @param hi
+ */
+static void random_side(unsigned long long *state, int size, int *lo, int *hi){
+    int a = random_coordinate(state, size);
+    int b = random_coordinate(state, size);
+    *lo = a < b ? a : b;
+    *hi = a < b ? b : a;
+}
+
+/**
+ *
+ * @param queryType
+ * @param threads
+ * @param size
+ * @return
+ */
+static Query *new_test_query(QueryType queryType, int threads, int size){
+    Query *query = newQuery(size, -1e9, 1e9, queryType);
+    if(threads > 1)
+        query->set_parallel(query, threads, 1);
+    query->new_cube(query, size);
+    return query;
+}
+
+/**
+ *
+ * @param size
+ * @param seed
+ * @return number of mismatches
+ */
+static int run(int size, unsigned long long seed){
+    QueryType types[] = { FENWICK, PREFIX_SUM, SPARSE, NAIVE };
+    int threads[] = { 1, 1, 1, 3 };
+    const char *names[] = { "fenwick", "prefix", "sparse", "naive-par" };
+    Query *reference = new_test_query(NAIVE, 1, size);
+    Query *queries[4];
+    Offline *offline = newOffline(reference);
+    long long *expected = malloc(TEST_COMMANDS*sizeof(long long));
+    unsigned long long state = seed ? seed : 1;
+    unsigned int num_expected = 0, i, q;
+    int errors = 0, k;
+
+    for(k = 0; k < 4; k++)
+        queries[k] = new_test_query(types[k], threads[k], size);
+    offline->reset(offline, size);
+    for(i = 0; i < TEST_COMMANDS; i++){
+        int v[6];
+        if(next_random(&state)%2){
+            random_side(&state, size, &v[0], &v[3]);
+            random_side(&state, size, &v[1], &v[4]);
+            random_side(&state, size, &v[2], &v[5]);
+            long long sum = (long long)reference->sum(reference, v[0], v[1], v[2], v[3], v[4], v[5]);
+            for(k = 0; k < 4; k++){
+                long long got = (long long)queries[k]->sum(queries[k], v[0], v[1], v[2], v[3], v[4], v[5]);
+                if(got != sum){
+                    fprintf(stderr, "ERROR N=%d SEED=%llu COMMAND %u: %s QUERY %d %d %d %d %d %d = %lld, naive = %lld\n",
+                            size, seed, i, names[k], v[0], v[1], v[2], v[3], v[4], v[5], got, sum);
+                    errors++;
+                }
+            }
+            offline->sum(offline, v[0], v[1], v[2], v[3], v[4], v[5]);
+            expected[num_expected++] = sum;
+        }else{
+            v[0] = random_coordinate(&state, size);
+            v[1] = random_coordinate(&state, size);
+            v[2] = random_coordinate(&state, size);
+            v[3] = random_between(&state, -999999999, 999999999);
+            reference->update(reference, v[0], v[1], v[2], v[3]);
+            for(k = 0; k < 4; k++)
+                queries[k]->update(queries[k], v[0], v[1], v[2], v[3]);
+            offline->update(offline, v[0], v[1], v[2], v[3]);
+        }
+    }
+    long long *answers = offline->solve(offline);
+    for(q = 0; q < num_expected; q++){
+        if(answers[q] != expected[q]){
+            fprintf(stderr, "ERROR N=%d SEED=%llu: offline QUERY %u = %lld, naive = %lld\n",
+                    size, seed, q, answers[q], expected[q]);
+            errors++;
+        }
+    }
+
+    free(expected);
+    destroyOffline(offline);
+    for(k = 0; k < 4; k++)
+        destroyQuery(queries[k]);
+    destroyQuery(reference);
+    return errors;
+}
+
+/**
+ *
+ * @param state
+ * @param size
+ * @param a
+ * @param b
+ * @param num_updates
+ */
+static void random_updates(unsigned long long *state, int size, Query *a, Query *b, int num_updates){
+    int i;
+    for(i = 0; i < num_updates; i++){
+        int x = random_coordinate(state, size);
+        int y = random_coordinate(state, size);
+        int z = random_coordinate(state, size);
+        int w = random_between(state, -999999999, 999999999);
+        a->update(a, x, y, z, w);
+        if(b != NULL)
+            b->update(b, x, y, z, w);
+    }
+}
+
+/**
+ *
+ * @param state
+ * @param size
+ * @param reference
+ * @param loaded
+ * @param name
+ * @return number of mismatches
+ */
+static int compare_sums(unsigned long long *state, int size, Query *reference, Query *loaded, const char *name){
+    int errors = 0, i;
+    for(i = 0; i < TEST_COMMANDS/4; i++){
+        int v[6];
+        random_side(state, size, &v[0], &v[3]);
+        random_side(state, size, &v[1], &v[4]);
+        random_side(state, size, &v[2], &v[5]);
+        long long expected = (long long)reference->sum(reference, v[0], v[1], v[2], v[3], v[4], v[5]);
+        long long got = (long long)loaded->sum(loaded, v[0], v[1], v[2], v[3], v[4], v[5]);
+        if(got != expected){
+            fprintf(stderr, "ERROR N=%d: %s SNAPSHOT QUERY %d %d %d %d %d %d = %lld, naive = %lld\n",
+                    size, name, v[0], v[1], v[2], v[3], v[4], v[5], got, expected);
+            errors++;
+        }
+    }
+    return errors;
+}
+
+/**
+ *
+ * @param size
+ * @param seed
+ * @return number of mismatches
+ */
+static int run_snapshot(int size, unsigned long long seed){
+    QueryType types[] = { NAIVE, FENWICK, PREFIX_SUM, SPARSE };
+    const char *names[] = { "naive", "fenwick", "prefix", "sparse" };
+    unsigned long long state = seed ? seed : 1;
+    char path[] = "cube_test_snapshot_XXXXXX";
+    int errors = 0, k;
+    int fd = mkstemp(path);
+    if(fd < 0){
+        fprintf(stderr, "ERROR CREATING %s\n", path);
+        return 1;
+    }
+    close(fd);
+    for(k = 0; k < 4; k++){
+        Query *reference = new_test_query(NAIVE, 1, size);
+        Query *saved = new_test_query(types[k], 1, size);
+        //the updates come last so a prefix-sum table is saved stale
+        random_updates(&state, size, saved, reference, TEST_COMMANDS/4);
+        int ok = saveSnapshot(saved, path);
+        destroyQuery(saved);
+        if(!ok){
+            destroyQuery(reference);
+            errors++;
+            continue;
+        }
+        Query *loaded = loadSnapshot(path, size, -1e9, 1e9);
+        if(loaded == NULL || loaded->queryType != types[k] || loaded->size != size){
+            fprintf(stderr, "ERROR N=%d: %s SNAPSHOT DID NOT LOAD\n", size, names[k]);
+            if(loaded != NULL)
+                destroyQuery(loaded);
+            destroyQuery(reference);
+            errors++;
+            continue;
+        }
+        errors += compare_sums(&state, size, reference, loaded, names[k]);
+        //updates write to the private mapping of the loaded query
+        random_updates(&state, size, loaded, reference, TEST_COMMANDS/4);
+        errors += compare_sums(&state, size, reference, loaded, names[k]);
+        destroyQuery(loaded);
+        destroyQuery(reference);
+    }
+    unlink(path);
+    return errors;
+}
+
+int main(int argc, char** argv){
+    unsigned long long seed = 42;
+    int errors = 0;
+    unsigned int i;
+    if(argc == 3 && !strcmp("-s", argv[1]))
+        seed = strtoull(argv[2], NULL, 10);
+    else if(argc != 1){
+        fprintf(stderr, "usage: %s [-s seed]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    for(i = 0; i < sizeof(sizes)/sizeof(sizes[0]); i++)
+        errors += run(sizes[i], seed + i) + run_snapshot(sizes[i], seed + i);
+    if(errors > 0){
+        fprintf(stderr, "%d MISMATCHES\n", errors);
+        return EXIT_FAILURE;
+    }
+    printf("OK\n");
+    return EXIT_SUCCESS;
+}
@@ -16,8 +16,9 @@ Graph newGraph( void* data, size_t size_data_node, size_t size_data_edge){
     privateDataGraph->size_data_node = size_data_node;
     privateDataGraph->size_data_edge = size_data_edge;
     privateDataGraph->data = data;
-    List *list = newListPtr(LINEAL, DOUBLE);
-    privateDataGraph->list_nodesADT = list;
+    privateDataGraph->num_nodes = 0;
+    privateDataGraph->num_edges = 0;
+    initIntrusiveList(&privateDataGraph->nodes);
 
     //Graph graph = new_graph(privateDataGraph);
     Graph graph = {
@@ -42,14 +43,14 @@ static struct PrivateDataGraph* get_private(Graph *this){
 }
 
 
-static Node* newNode(Graph *this, unsigned int id, void* data, List *edges){
+static Node* newNode(Graph *this, unsigned int id, void* data){
     struct PrivateDataGraph *private = get_private(this);
 
     Node *new_node = malloc(sizeof(Node));
     new_node->id = id;
-    new_node->data = malloc(sizeof(void *));
+    new_node->data = malloc(private->size_data_node);
     memcpy(new_node->data, data, private->size_data_node);
-    new_node->edges = edges;
+    initIntrusiveList(&new_node->edges);
 
     return new_node;
 }
@@ -77,8 +78,8 @@ static Edge* newEdge(Graph *this, unsigned int id, void* data, Node* node){
 
     Edge *new_edge = malloc(sizeof(Edge));
     new_edge->id = id;
-    new_edge->data = malloc(sizeof(void*));
-    memcpy(new_edge->data, data, private->size_data_node);
+    new_edge->data = malloc(private->size_data_edge);
+    memcpy(new_edge->data, data, private->size_data_edge);
     new_edge->node = node;
 
     return new_edge;
@@ -89,16 +90,17 @@ static Edge* newEdge(Graph *this, unsigned int id, void* data, Node* node){
  * @param this
  * @param n1_node
  * @param n2_node
- * @return
+ * @return edge of n1_node that goes to n2_node
  */
 static Edge* _get_edge(Graph *this, unsigned int n1_node, unsigned int n2_node){
     Node *n1 = this->get_node(this, n1_node);
-    Edge** edges = (Edge**)n1->edges->get(n1->edges).all();
-    unsigned int i;
-    unsigned int size = n1->edges->get_size(n1->edges);
-    for(i = 0; i< size; i++){
-        if(edges[i]->id == n2_node){
-            return edges[i];
+    ListLink *link;
+    if(n1 == NULL)
+        return NULL;
+    for(link = beginIntrusiveList(&n1->edges); link != NULL; link = nextIntrusiveList(&n1->edges, link)){
+        Edge *edge = LIST_ENTRY(link, Edge, link);
+        if(edge->node->id == n2_node){
+            return edge;
         }
     }
     return NULL;
@@ -112,12 +114,11 @@ static Edge* _get_edge(Graph *this, unsigned int n1_node, unsigned int n2_node){
  */
 static Node* _get_node(Graph *this, unsigned int id){
     struct PrivateDataGraph *private = get_private(this);
-    Node ** nodes = (Node**)private->list_nodesADT->get(private->list_nodesADT).all();
-    unsigned int size = this->get_num_nodes(this);
-    unsigned int i;
-    for(i = 0; i< size; i++){
-        if(nodes[i]->id == id){
-            return nodes[i];
+    IntrusiveList *nodes = &private->nodes;
+    ListLink *link;
+    for(link = beginIntrusiveList(nodes); link != NULL; link = nextIntrusiveList(nodes, link)){
+        if(LIST_ENTRY(link, Node, link)->id == id){
+            return LIST_ENTRY(link, Node, link);
         }
     }
     return NULL;
@@ -125,8 +126,8 @@ static Node* _get_node(Graph *this, unsigned int id){
 
 static int _create_node(Graph *this, unsigned int id, void* data){
     struct PrivateDataGraph *private = get_private(this);
-    Node *new_node = newNode(this, id, data, newListPtr(LINEAL, DOUBLE));
-    private->list_nodesADT->insert(private->list_nodesADT).top(new_node, NULL);
+    Node *new_node = newNode(this, id, data);
+    insertTopIntrusiveList(&private->nodes, &new_node->link);
     private->num_nodes++;
     return 1;
 }
@@ -135,10 +136,12 @@ static int _create_edge(Graph *this, unsigned int id, void* data, unsigned int n
     struct PrivateDataGraph *private = get_private(this);
     Node *node_n1 = this->get_node(this, n1);
     Node *node_n2 = this->get_node(this, n2);
+    if(node_n1 == NULL || node_n2 == NULL)
+        return 0;
     Edge *new_edge1 = newEdge(this, id, data, node_n2);
     Edge *new_edge2 = newEdge(this, id, data, node_n1);
-    node_n1->edges->insert(node_n1->edges).top(new_edge1, NULL);
-    node_n2->edges->insert(node_n2->edges).top(new_edge2, NULL);
+    insertTopIntrusiveList(&node_n1->edges, &new_edge1->link);
+    insertTopIntrusiveList(&node_n2->edges, &new_edge2->link);
     private->num_edges++;
     return 1;
 }
@@ -169,41 +172,48 @@ unsigned int _get_num_edges(Graph *this){
  */
 static void _print(Graph *this, void(*callback)(const void* d)){
     struct PrivateDataGraph *private = get_private(this);
-    Node ** nodes = (Node**)private->list_nodesADT->get(private->list_nodesADT).all();
-    unsigned int size = this->get_num_nodes(this);
-    unsigned int i;
-    for(i = 0; i< size; i++){
+    IntrusiveList *nodes = &private->nodes;
+    ListLink *link, *edge;
+    for(link = beginIntrusiveList(nodes); link != NULL; link = nextIntrusiveList(nodes, link)){
+        Node *node = LIST_ENTRY(link, Node, link);
         if (callback != NULL){
-            callback(nodes[i]);
-            nodes[i]->edges->print(nodes[i]->edges, callback);
+            callback(node);
+            for(edge = beginIntrusiveList(&node->edges); edge != NULL; edge = nextIntrusiveList(&node->edges, edge))
+                callback(LIST_ENTRY(edge, Edge, link));
         }
-        //nodes[i]->edges->print(nodes[i]->edges, callback);
     }
 }
 
 /**
  *
+ * @param link
+ */
+static void free_edge(ListLink *link){
+    Edge *edge = LIST_ENTRY(link, Edge, link);
+    free(edge->data);
+    free(edge);
+}
+
+/**
+ *
+ * @param link
+ */
+static void free_node(ListLink *link){
+    Node *node = LIST_ENTRY(link, Node, link);
+    emptyIntrusiveList(&node->edges, free_edge);
+    free(node->data);
+    free(node);
+}
+
+/**
+ *
+ * @details Nodes and edges are unlinked and freed in one walk.
  * @param this
  * @return
  */
 int _empty_graph(Graph *this){
     struct PrivateDataGraph *private = get_private(this);
-    Node ** nodes = (Node**)private->list_nodesADT->get(private->list_nodesADT).all();
-    unsigned int size = this->get_num_nodes(this);
-    unsigned int i;
-    for(i = 0; i< size; i++){
-        free(nodes[i]->data);
-        Edge ** edges = nodes[i]->edges->get(nodes[i]->edges).all();
-        unsigned int size_edges = nodes[i]->edges->get_size(nodes[i]->edges);
-        unsigned int j;
-        for(j = 0; j< size_edges; j++) {
-            free(edges[i]->data);
-        }
-        destroyList(nodes[i]->edges);
-        free(*edges);
-    }
-
-    free(*nodes);
+    emptyIntrusiveList(&private->nodes, free_node);
     private->num_edges = 0;
     private->num_nodes = 0;
     return 0;
@@ -1,7 +1,7 @@
 #ifndef GRAPH_H
 #define GRAPH_H
 
-#include "list.h"
+#include "../lists/intrusive_list.h"
 #include <memory.h>
 
 #ifdef __cplusplus
@@ -16,12 +16,14 @@ struct Edge{
     unsigned int id;
     Node *node;
     void* data;
+    ListLink link;//in the edges of its node
 };
 
 struct Node{
     unsigned int id;
     void* data;
-    List* edges;
+    IntrusiveList edges;
+    ListLink link;//in the nodes of the graph
 };
 
 struct PrivateDataGraph{
@@ -30,7 +32,7 @@ struct PrivateDataGraph{
     unsigned int num_nodes;
     unsigned int num_edges;
     void* data;
-    List* list_nodesADT;
+    IntrusiveList nodes;
 };
 
 struct Graph{
@@ -0,0 +1,129 @@
+#include "intrusive_list.h"
+
+/**
+ *
+ * @param this list embedded by the caller, empty afterwards
+ */
+void initIntrusiveList(IntrusiveList *this){
+    this->head.prev = &this->head;
+    this->head.next = &this->head;
+    this->size = 0;
+}
+
+static void link_between(ListLink *prev, ListLink *next, ListLink *link){
+    link->prev = prev;
+    link->next = next;
+    prev->next = link;
+    next->prev = link;
+}
+
+/**
+ *
+ * @param this
+ * @return
+ */
+unsigned int getSizeIntrusiveList(IntrusiveList *this){
+    return this->size;
+}
+
+/**
+ *
+ * @param this
+ * @param link not linked in any list through this member
+ */
+void insertTopIntrusiveList(IntrusiveList *this, ListLink *link){
+    link_between(&this->head, this->head.next, link);
+    this->size++;
+}
+
+/**
+ *
+ * @param this
+ * @param link not linked in any list through this member
+ */
+void insertBottomIntrusiveList(IntrusiveList *this, ListLink *link){
+    link_between(this->head.prev, &this->head, link);
+    this->size++;
+}
+
+/**
+ *
+ * @param this
+ * @param pos link in this list
+ * @param link not linked in any list through this member
+ */
+void insertAfterIntrusiveList(IntrusiveList *this, ListLink *pos, ListLink *link){
+    link_between(pos, pos->next, link);
+    this->size++;
+}
+
+/**
+ *
+ * @param this
+ * @param link in this list, NULL-linked afterwards
+ */
+void removeIntrusiveList(IntrusiveList *this, ListLink *link){
+    link->prev->next = link->next;
+    link->next->prev = link->prev;
+    link->prev = NULL;
+    link->next = NULL;
+    this->size--;
+}
+
+/**
+ *
+ * @param this
+ * @return top link, NULL if empty
+ */
+ListLink* beginIntrusiveList(IntrusiveList *this){
+    return this->head.next != &this->head ? this->head.next : NULL;
+}
+
+/**
+ *
+ * @param this
+ * @return bottom link, NULL if empty
+ */
+ListLink* lastIntrusiveList(IntrusiveList *this){
+    return this->head.prev != &this->head ? this->head.prev : NULL;
+}
+
+/**
+ *
+ * @param this
+ * @param link
+ * @return link after it, NULL past the bottom
+ */
+ListLink* nextIntrusiveList(IntrusiveList *this, ListLink *link){
+    return link->next != &this->head ? link->next : NULL;
+}
+
+/**
+ *
+ * @param this
+ * @param link
+ * @return link before it, NULL past the top
+ */
+ListLink* prevIntrusiveList(IntrusiveList *this, ListLink *link){
+    return link->prev != &this->head ? link->prev : NULL;
+}
+
+/**
+ *
+ * @details Each link is unlinked before the callback gets it, so the
+ * callback may free its element.
+ * @param this
+ * @param callback may be NULL
+ */
+void emptyIntrusiveList(IntrusiveList *this, void(*callback)(ListLink *link)){
+    ListLink *link = this->head.next, *next;
+    while(link != &this->head){
+        next = link->next;
+        link->prev = NULL;
+        link->next = NULL;
+        if(callback != NULL)
+            callback(link);
+        link = next;
+    }
+    initIntrusiveList(this);
+}
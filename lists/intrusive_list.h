@@ -0,0 +1,58 @@
+#ifndef INTRUSIVE_LIST_H
+#define INTRUSIVE_LIST_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Intrusive double list: the links live inside the caller's struct, and so
+ * does the list itself, a circular sentinel and a size. Initializing,
+ * inserting and deleting allocate nothing and an element is reached
+ * without going through a list node. The list never owns its elements,
+ * emptying it only unlinks them. A list must not be copied once
+ * initialized, its sentinel points to itself.
+ *
+ *     struct Item{ int value; ListLink link; };
+ *     IntrusiveList list;
+ *     initIntrusiveList(&list);
+ *     insertTopIntrusiveList(&list, &item->link);
+ *     for(l = beginIntrusiveList(&list); l != NULL; l = nextIntrusiveList(&list, l))
+ *         use(LIST_ENTRY(l, struct Item, link)->value);
+ *
+ * An element can be in as many lists as it has links.
+ */
+typedef struct IntrusiveList IntrusiveList;
+
+typedef struct ListLink{
+    struct ListLink* prev;
+    struct ListLink* next;
+}ListLink;
+
+#define LIST_ENTRY(link, type, member) ((type*)((char*)(link) - offsetof(type, member)))
+
+struct IntrusiveList{
+    ListLink head;//circular sentinel, head.next is the top
+    unsigned int size;
+};
+
+void initIntrusiveList(IntrusiveList *this);
+unsigned int getSizeIntrusiveList(IntrusiveList *this);
+void insertTopIntrusiveList(IntrusiveList *this, ListLink *link);
+void insertBottomIntrusiveList(IntrusiveList *this, ListLink *link);
+void insertAfterIntrusiveList(IntrusiveList *this, ListLink *pos, ListLink *link);
+void removeIntrusiveList(IntrusiveList *this, ListLink *link);
+ListLink* beginIntrusiveList(IntrusiveList *this);
+ListLink* lastIntrusiveList(IntrusiveList *this);
+ListLink* nextIntrusiveList(IntrusiveList *this, ListLink *link);
+ListLink* prevIntrusiveList(IntrusiveList *this, ListLink *link);
+void emptyIntrusiveList(IntrusiveList *this, void(*callback)(ListLink *link));
+
+#ifdef  __cplusplus
+}
+#endif
+#endif
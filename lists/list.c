@@ -12,6 +12,7 @@ static struct PrivateDataListSimple* createPrivateDataListSimple(){
     ps->listADT = NULL,
     ps->bottom = NULL,
     ps->top = NULL;
+    ps->pool = NULL;
     return ps;
 }
 
@@ -25,9 +26,228 @@ static struct PrivateDataListDouble* createPrivateDataListDouble(){
             ps->listADT = NULL,
             ps->bottom = NULL,
             ps->top = NULL;
+    ps->pool = NULL;
     return ps;
 }
 
+/**
+ *
+ * @return struct PrivateDataListUnrolled*
+ */
+static struct PrivateDataListUnrolled* createPrivateDataListUnrolled(){
+    struct PrivateDataListUnrolled *pu = malloc(sizeof(struct PrivateDataListUnrolled));
+    pu->size = 0;
+    pu->capacity = LIST_UNROLLED_MIN_CAPACITY;
+    pu->bottom = NULL;
+    pu->top = NULL;
+    return pu;
+}
+
+/**
+ *
+ * @param capacity
+ * @return
+ */
+static UnrolledADT new_chunk(unsigned int capacity){
+    UnrolledADT chunk = (UnrolledADT)malloc(sizeof(ELEMENT_UNROLLED_LIST) + capacity*sizeof(void*));
+    if(chunk != NULL){
+        chunk->prev = NULL;
+        chunk->next = NULL;
+        chunk->count = 0;
+    }
+    return chunk;
+}
+
+/**
+ *
+ * @details Links chunk after prev, or first when prev is NULL.
+ * @param private
+ * @param prev
+ * @param chunk
+ */
+static void link_chunk(struct PrivateDataListUnrolled *private, UnrolledADT prev, UnrolledADT chunk){
+    chunk->prev = prev;
+    chunk->next = prev != NULL ? prev->next : private->bottom;
+    if(chunk->next != NULL)
+        chunk->next->prev = chunk;
+    else
+        private->top = chunk;
+    if(prev != NULL)
+        prev->next = chunk;
+    else
+        private->bottom = chunk;
+}
+
+/**
+ *
+ * @param private
+ * @param chunk
+ */
+static void unlink_chunk(struct PrivateDataListUnrolled *private, UnrolledADT chunk){
+    if(chunk->prev != NULL)
+        chunk->prev->next = chunk->next;
+    else
+        private->bottom = chunk->next;
+    if(chunk->next != NULL)
+        chunk->next->prev = chunk->prev;
+    else
+        private->top = chunk->prev;
+    free(chunk);
+}
+
+/**
+ *
+ * @details Skips whole chunks from the nearest end.
+ * @param private
+ * @param p position, below size
+ * @param offset receives the slot of p in the chunk
+ * @return chunk holding p
+ */
+static UnrolledADT unrolled_find(struct PrivateDataListUnrolled *private, unsigned int p, unsigned int *offset){
+    UnrolledADT chunk;
+    if(p < private->size/2){
+        chunk = private->bottom;
+        while(p >= chunk->count){
+            p -= chunk->count;
+            chunk = chunk->next;
+        }
+        *offset = p;
+    }else{
+        unsigned int from_top = private->size - p;
+        chunk = private->top;
+        while(from_top > chunk->count){
+            from_top -= chunk->count;
+            chunk = chunk->prev;
+        }
+        *offset = chunk->count - from_top;
+    }
+    return chunk;
+}
+
+/**
+ *
+ * @details Copies the elements into half full chunks of the new capacity.
+ * @param private
+ * @param capacity
+ * @return
+ */
+static int unrolled_repack(struct PrivateDataListUnrolled *private, unsigned int capacity){
+    struct PrivateDataListUnrolled repacked = {NULL, NULL, capacity, private->size};
+    UnrolledADT chunk, fill = NULL;
+    unsigned int i;
+    for(chunk = private->bottom; chunk != NULL; chunk = chunk->next){
+        for(i = 0; i < chunk->count; i++){
+            if(fill == NULL || fill->count == capacity/2){
+                UnrolledADT new = new_chunk(capacity);
+                if(new == NULL){
+                    while(repacked.bottom != NULL)
+                        unlink_chunk(&repacked, repacked.bottom);
+                    return 0;
+                }
+                link_chunk(&repacked, fill, new);
+                fill = new;
+            }
+            fill->data[fill->count++] = chunk->data[i];
+        }
+    }
+    while(private->bottom != NULL)
+        unlink_chunk(private, private->bottom);
+    *private = repacked;
+    return 1;
+}
+
+/**
+ *
+ * @details Keeps the capacity near sqrt(size).
+ * @param private
+ */
+static void unrolled_balance(struct PrivateDataListUnrolled *private){
+    unsigned long capacity = private->capacity;
+    while((unsigned long)private->size > 2*capacity*capacity)
+        capacity *= 2;
+    while(capacity > LIST_UNROLLED_MIN_CAPACITY && (unsigned long)private->size < capacity*capacity/8)
+        capacity /= 2;
+    if(capacity != private->capacity)
+        unrolled_repack(private, (unsigned int)capacity);
+}
+
+/**
+ *
+ * @details A full chunk is split in two halves first.
+ * @param private
+ * @param p position, up to size
+ * @param data
+ * @return
+ */
+static int unrolled_insert(struct PrivateDataListUnrolled *private, unsigned int p, const void* data){
+    UnrolledADT chunk;
+    unsigned int offset;
+    if(p > private->size)
+        return 0;
+    if(private->size == 0 && private->bottom == NULL){
+        chunk = new_chunk(private->capacity);
+        if(chunk == NULL)
+            return 0;
+        link_chunk(private, NULL, chunk);
+    }
+    if(p == private->size){
+        chunk = private->top;
+        offset = chunk->count;
+    }else{
+        chunk = unrolled_find(private, p, &offset);
+    }
+    if(chunk->count == private->capacity){
+        UnrolledADT new = new_chunk(private->capacity);
+        unsigned int half = chunk->count/2;
+        if(new == NULL)
+            return 0;
+        memcpy(new->data, chunk->data + half, (chunk->count - half)*sizeof(void*));
+        new->count = chunk->count - half;
+        chunk->count = half;
+        link_chunk(private, chunk, new);
+        if(offset > half){
+            offset -= half;
+            chunk = new;
+        }
+    }
+    memmove(chunk->data + offset + 1, chunk->data + offset, (chunk->count - offset)*sizeof(void*));
+    chunk->data[offset] = (void*)data;
+    chunk->count++;
+    private->size++;
+    unrolled_balance(private);
+    return 1;
+}
+
+/**
+ *
+ * @details An emptied chunk is released, a chunk that fits in a neighbour
+ * is merged into it.
+ * @param private
+ * @param p position, below size
+ * @return the element removed
+ */
+static void* unrolled_delete(struct PrivateDataListUnrolled *private, unsigned int p){
+    unsigned int offset;
+    UnrolledADT chunk = unrolled_find(private, p, &offset);
+    void* data = chunk->data[offset];
+    chunk->count--;
+    memmove(chunk->data + offset, chunk->data + offset + 1, (chunk->count - offset)*sizeof(void*));
+    private->size--;
+    if(chunk->count == 0){
+        unlink_chunk(private, chunk);
+    }else{
+        if(chunk->next != NULL && chunk->count + chunk->next->count <= private->capacity)
+            chunk = chunk->next;
+        if(chunk->prev != NULL && chunk->count + chunk->prev->count <= private->capacity){
+            memcpy(chunk->prev->data + chunk->prev->count, chunk->data, chunk->count*sizeof(void*));
+            chunk->prev->count += chunk->count;
+            unlink_chunk(private, chunk);
+        }
+    }
+    unrolled_balance(private);
+    return data;
+}
+
 /**
  *
  * @param listType
@@ -39,11 +259,16 @@ static List* createList(ListType listType, LinkType linkType, void *private){
     List *listSimple = malloc(sizeof(List));
     listSimple->insert = _insert_list,
     listSimple->print = _print_list,
-    listSimple->get_size = _get_size,
+    listSimple->get_size = _get_size_list,
     listSimple->delete = _delete_list,
     listSimple->empty = _empty_list,
     listSimple->update = _update_list,
     listSimple->get = _get_list,
+    listSimple->begin = _begin_list,
+    listSimple->last = _last_list,
+    listSimple->next = _next_list,
+    listSimple->prev = _prev_list,
+    listSimple->foreach = _foreach_list,
     listSimple->listType = listType,
     listSimple->linkType = linkType,
     listSimple->private = private;
@@ -70,7 +295,14 @@ List* newListPtr(ListType listType, LinkType linkType){
             List *listSimple = createList(listType, linkType, ps);
             return listSimple;
         }
+
+        case UNROLLED:{
+            struct PrivateDataListUnrolled *pu = createPrivateDataListUnrolled();
+            List *listUnrolled = createList(LINEAL, linkType, pu);
+            return listUnrolled;
+        }
     }
+    return NULL;
 }
 
 /**
@@ -87,11 +319,16 @@ List newList(ListType listType, LinkType linkType){
             List listSimple = {
                     .insert = _insert_list,
                     .print = _print_list,
-                    .get_size = _get_size,
+                    .get_size = _get_size_list,
                     .delete = _delete_list,
                     .empty = _empty_list,
                     .update = _update_list,
                     .get = _get_list,
+                    .begin = _begin_list,
+                    .last = _last_list,
+                    .next = _next_list,
+                    .prev = _prev_list,
+                    .foreach = _foreach_list,
                     .listType = listType,
                     .linkType = linkType,
                     .private = ps,
@@ -100,6 +337,7 @@ List newList(ListType listType, LinkType linkType){
             ps->listADT = NULL;
             ps->bottom = NULL;
             ps->top = NULL;
+            ps->pool = NULL;
             return listSimple;
         }
 
@@ -109,203 +347,312 @@ List newList(ListType listType, LinkType linkType){
             pd->listADT = NULL;
             pd->bottom = NULL;
             pd->top = NULL;
+            pd->pool = NULL;
             List listDouble = {
                     .insert = _insert_list,
                     .print = _print_list,
-                    .get_size = _get_size,
+                    .get_size = _get_size_list,
                     .delete = _delete_list,
                     .empty = _empty_list,
                     .update = _update_list,
                     .get = _get_list,
+                    .begin = _begin_list,
+                    .last = _last_list,
+                    .next = _next_list,
+                    .prev = _prev_list,
+                    .foreach = _foreach_list,
                     .listType = listType,
                     .linkType = linkType,
                     .private = pd,
             };
             return listDouble;
         }
+
+        case UNROLLED:{
+            List listUnrolled = {
+                    .insert = _insert_list,
+                    .print = _print_list,
+                    .get_size = _get_size_list,
+                    .delete = _delete_list,
+                    .empty = _empty_list,
+                    .update = _update_list,
+                    .get = _get_list,
+                    .begin = _begin_list,
+                    .last = _last_list,
+                    .next = _next_list,
+                    .prev = _prev_list,
+                    .foreach = _foreach_list,
+                    .listType = LINEAL,
+                    .linkType = UNROLLED,
+                    .private = createPrivateDataListUnrolled(),
+            };
+            return listUnrolled;
+        }
     }
+    //unknown linkType, a list without private data like the NULL of newListPtr
+    List none = {
+            .listType = listType,
+            .linkType = linkType,
+            .private = NULL,
+    };
+    return none;
 }
 
 /**
  *
  * @param this
+ * @param data_to_insert
+ * @param callback
  * @return
  */
-InsertList _insert_list(List *this){
-    static  List* static_this;
-    static_this = this;
-
-    int top(const void* data_to_insert, void(*callback)(const void* d)){
-        switch(static_this->linkType){
-            case SIMPLE: {
-                struct PrivateDataListSimple *private = (struct PrivateDataListSimple*)static_this->private;
-                SimpleADT new_simple = (SimpleADT) malloc(sizeof(ELEMENT_SIMPLE_LIST));
-                if (new_simple != NULL) {
-                    if (callback != NULL)
-                        callback(data_to_insert);
-                    if( static_this->linkType == CIRCULAR ){
-                        new_simple->next = private->bottom;
-                    } else if(static_this->linkType == LINEAL){
-                        new_simple->next = NULL;
-                    }
-                    new_simple->data = (void *) data_to_insert;
-                    if(private->listADT == NULL){
-                        private->listADT = new_simple;
-                        private->bottom = new_simple;
-                    } else
-                        private->top->next = new_simple;
-                    private->top = new_simple;
-                    private->size++;
-                    return 1;
-                } else {
-                    return 0;
+static int _insert_top_list(List *this, const void* data_to_insert, void(*callback)(const void* d)){
+    switch(this->linkType){
+        case SIMPLE: {
+            struct PrivateDataListSimple *private = (struct PrivateDataListSimple*)this->private;
+            SimpleADT new_simple = (SimpleADT) allocNode(private->pool, sizeof(ELEMENT_SIMPLE_LIST));
+            if (new_simple != NULL) {
+                if (callback != NULL)
+                    callback(data_to_insert);
+                if( this->listType == CIRCULAR ){
+                    new_simple->next = private->bottom;
+                } else if(this->listType == LINEAL){
+                    new_simple->next = NULL;
                 }
+                new_simple->data = (void *) data_to_insert;
+                if(private->listADT == NULL){
+                    private->listADT = new_simple;
+                    private->bottom = new_simple;
+                } else
+                    private->top->next = new_simple;
+                private->top = new_simple;
+                private->size++;
+                return 1;
+            } else {
+                return 0;
             }
-            case DOUBLE: {
-                struct PrivateDataListDouble *private = (struct PrivateDataListDouble*)this->private;
-                DoubleADT new_double = (DoubleADT) malloc(sizeof(ELEMENT_DOUBLE_LIST));
-                if (new_double != NULL) {
-                    if (callback != NULL)
-                        callback(data_to_insert);
-                    if( static_this->linkType == CIRCULAR ){
-                        new_double->next = private->bottom;
-                    } else if(static_this->linkType == LINEAL){
-                        new_double->next = NULL;
-                    }
+        }
+        case DOUBLE: {
+            struct PrivateDataListDouble *private = (struct PrivateDataListDouble*)this->private;
+            DoubleADT new_double = (DoubleADT) allocNode(private->pool, sizeof(ELEMENT_DOUBLE_LIST));
+            if (new_double != NULL) {
+                if (callback != NULL)
+                    callback(data_to_insert);
+                if( this->listType == CIRCULAR ){
+                    new_double->next = private->bottom;
+                } else if(this->listType == LINEAL){
+                    new_double->next = NULL;
+                }
+                new_double->prev = private->top;
+                new_double->data = (void *) data_to_insert;
+                if(private->listADT == NULL){
+                    private->listADT = new_double;
+                    private->bottom = new_double;
+                } else
+                    private->top->next = new_double;
+                private->top = new_double;
+                private->size++;
+                return 1;
+            } else {
+                return 0;
+            }
+            break;
+        }
+        case UNROLLED: {
+            struct PrivateDataListUnrolled *private = (struct PrivateDataListUnrolled*)this->private;
+            if (callback != NULL)
+                callback(data_to_insert);
+            return unrolled_insert(private, private->size, data_to_insert);
+        }
+    }
+    return 0;
+}
+
+/**
+ *
+ * @param this
+ * @param data_to_insert
+ * @param callback
+ * @return
+ */
+static int _insert_bottom_list(List *this, const void* data_to_insert, void(*callback)(const void* d)){
+    switch(this->linkType){
+        case SIMPLE: {
+            struct PrivateDataListSimple *private = (struct PrivateDataListSimple*)this->private;
+            SimpleADT new_simple = (SimpleADT) allocNode(private->pool, sizeof(ELEMENT_SIMPLE_LIST));
+            if (new_simple != NULL) {
+                if (callback != NULL)
+                    callback(data_to_insert);
+                new_simple->next = private->bottom;
+                new_simple->data = (void *) data_to_insert;
+                if(private->bottom == NULL)
+                    private->top = new_simple;
+                private->listADT = new_simple;
+                private->bottom = new_simple;
+                private->size++;
+                return 1;
+            } else {
+                return 0;
+            }
+        }
+        case DOUBLE: {
+            struct PrivateDataListDouble *private = (struct PrivateDataListDouble*)this->private;
+            DoubleADT new_double = (DoubleADT) allocNode(private->pool, sizeof(ELEMENT_DOUBLE_LIST));
+            if (new_double != NULL) {
+                if (callback != NULL)
+                    callback(data_to_insert);
+                new_double->next = private->bottom;
+                if( this->listType == CIRCULAR ){
                     new_double->prev = private->top;
-                    new_double->data = (void *) data_to_insert;
-                    if(private->listADT == NULL){
-                        private->listADT = new_double;
-                        private->bottom = new_double;
-                    } else
-                        private->top->next = new_double;
-                    private->top = new_double;
-                    private->size++;
-                    return 1;
-                } else {
-                    return 0;
+                } else if(this->listType == LINEAL){
+                    new_double->prev = NULL;
                 }
-                break;
+                new_double->data = (void *) data_to_insert;
+                if(private->bottom != NULL)
+                    private->bottom->prev = new_double;
+                else
+                    private->top = new_double;
+                private->listADT = new_double;
+                private->bottom = new_double;
+                private->size++;
+                return 1;
+            } else {
+                return 0;
             }
+            break;
+        }
+        case UNROLLED: {
+            struct PrivateDataListUnrolled *private = (struct PrivateDataListUnrolled*)this->private;
+            if (callback != NULL)
+                callback(data_to_insert);
+            return unrolled_insert(private, 0, data_to_insert);
         }
-        return 0;
     }
+    return 0;
+}
 
-    int bottom(const void* data_to_insert, void(*callback)(const void* d)){
-        switch(static_this->linkType){
-            case SIMPLE: {
-                struct PrivateDataListSimple *private = (struct PrivateDataListSimple*)static_this->private;
-                SimpleADT new_simple = (SimpleADT) malloc(sizeof(ELEMENT_SIMPLE_LIST));
+/**
+ *
+ * @param this
+ * @param p
+ * @param data_to_insert
+ * @param callback
+ * @return
+ */
+static int _insert_pos_list(List *this, unsigned int p, const void* data_to_insert, void(*callback)(const void* d)){
+    switch(this->linkType){
+        case SIMPLE: {
+            struct PrivateDataListSimple *private = (struct PrivateDataListSimple*)this->private;
+            if(p<0 || p>private->size){
+                return 0;
+            }else if(p == private->size-1){
+                return this->insert(this).top(this, data_to_insert, callback);
+            }else if(p == 0){
+                return this->insert(this).bottom(this, data_to_insert, callback);
+            }else {
+                SimpleADT simpleADT = private->listADT;
+                int i = 1;
+                while (i < p) {
+                    simpleADT = simpleADT->next;
+                    i++;
+                }
+                SimpleADT new_simple = (SimpleADT) allocNode(private->pool, sizeof(ELEMENT_SIMPLE_LIST));
                 if (new_simple != NULL) {
                     if (callback != NULL)
                         callback(data_to_insert);
-                    new_simple->next = private->bottom;
                     new_simple->data = (void *) data_to_insert;
-                    private->listADT = new_simple;
-                    private->bottom = new_simple;
+                    new_simple->next = simpleADT->next;
+                    simpleADT->next = new_simple;
                     private->size++;
                     return 1;
                 } else {
                     return 0;
                 }
             }
-            case DOUBLE: {
-                struct PrivateDataListDouble *private = (struct PrivateDataListDouble*)this->private;
-                DoubleADT new_double = (DoubleADT) malloc(sizeof(ELEMENT_DOUBLE_LIST));
+        }
+        case DOUBLE: {
+            struct PrivateDataListDouble *private = (struct PrivateDataListDouble*)this->private;
+            if(p<0 || p>private->size){
+                return 0;
+            }else if(p == 0){
+                return this->insert(this).bottom(this, data_to_insert, callback);
+            }else {
+                DoubleADT doubleADT = private->listADT;
+                int i = 1;
+                while (i < p) {
+                    doubleADT = doubleADT->next;
+                    i++;
+                }
+                DoubleADT new_double = (DoubleADT) allocNode(private->pool, sizeof(ELEMENT_DOUBLE_LIST));
                 if (new_double != NULL) {
                     if (callback != NULL)
                         callback(data_to_insert);
-                    new_double->next = private->bottom;
-                    if( static_this->linkType == CIRCULAR ){
-                        new_double->prev = private->top;
-                    } else if(static_this->linkType == LINEAL){
-                        new_double->prev = NULL;
-                    }
                     new_double->data = (void *) data_to_insert;
-                    private->listADT = new_double;
-                    private->bottom = new_double;
+                    new_double->next = doubleADT->next;
+                    new_double->prev = doubleADT;
+                    if(doubleADT == private->top)
+                        private->top = new_double;
+                    else
+                        doubleADT->next->prev = new_double;
+                    doubleADT->next = new_double;
                     private->size++;
                     return 1;
                 } else {
                     return 0;
                 }
-                break;
             }
         }
-        return 0;
-    }
-
-    int pos(unsigned int p, const void* data_to_insert, void(*callback)(const void* d)){
-        switch(static_this->linkType){
-            case SIMPLE: {
-                struct PrivateDataListSimple *private = (struct PrivateDataListSimple*)static_this->private;
-                if(p<0 || p>private->size){
-                    return 0;
-                }else if(p == private->size-1){
-                    return static_this->insert(static_this).top(data_to_insert, callback);
-                }else if(p == 0){
-                    return static_this->insert(static_this).bottom(data_to_insert, callback);
-                }else {
-                    SimpleADT simpleADT = private->listADT;
-                    int i = 1;
-                    while (i < p) {
-                        simpleADT = simpleADT->next;
-                        i++;
-                    }
-                    SimpleADT new_simple = (SimpleADT) malloc(sizeof(ELEMENT_SIMPLE_LIST));
-                    if (new_simple != NULL) {
-                        if (callback != NULL)
-                            callback(data_to_insert);
-                        new_simple->data = (void *) data_to_insert;
-                        new_simple->next = simpleADT->next;
-                        simpleADT->next = new_simple;
-                        private->size++;
-                        return 1;
-                    } else {
-                        return 0;
-                    }
-                }
-            }
-            case DOUBLE: {
-                struct PrivateDataListDouble *private = (struct PrivateDataListDouble*)static_this->private;
-                if(p<0 || p>private->size){
-                    return 0;
-                }else if(p == 0){
-                    return static_this->insert(static_this).bottom(data_to_insert, callback);
-                }else {
-                    DoubleADT doubleADT = private->listADT;
-                    int i = 1;
-                    while (i < p) {
-                        doubleADT = doubleADT->next;
-                        i++;
-                    }
-                    DoubleADT new_double = (DoubleADT) malloc(sizeof(ELEMENT_DOUBLE_LIST));
-                    if (new_double != NULL) {
-                        if (callback != NULL)
-                            callback(data_to_insert);
-                        new_double->data = (void *) data_to_insert;
-                        new_double->next = doubleADT->next;
-                        new_double->prev = doubleADT;
-                        doubleADT->next = new_double;
-                        private->size++;
-                        return 1;
-                    } else {
-                        return 0;
-                    }
-                }
-            }
+        case UNROLLED: {
+            struct PrivateDataListUnrolled *private = (struct PrivateDataListUnrolled*)this->private;
+            if(p > private->size)
+                return 0;
+            if (callback != NULL)
+                callback(data_to_insert);
+            return unrolled_insert(private, p, data_to_insert);
         }
-        return 0;
     }
+    return 0;
+}
 
-    InsertList insert = {
-        .top = top,
-        .bottom = bottom,
-        .pos = pos
-    };
+static const InsertList insert_list = {
+    .top = _insert_top_list,
+    .bottom = _insert_bottom_list,
+    .pos = _insert_pos_list
+};
 
+/**
+ *
+ * @details Nodes of a SIMPLE or DOUBLE list come from pool, which must
+ * outlive the list. An UNROLLED list, or a pool with nodes smaller than the
+ * list node, ignores it.
+ * @param listType
+ * @param linkType
+ * @param pool NULL for malloc
+ * @return
+ */
+List newPooledList(ListType listType, LinkType linkType, NodePool *pool){
+    List list = newList(listType, linkType);
+    switch (linkType){
+        case SIMPLE:
+            ((struct PrivateDataListSimple*)list.private)->pool = acceptNodePool(pool, sizeof(ELEMENT_SIMPLE_LIST));
+            break;
+        case DOUBLE:
+            ((struct PrivateDataListDouble*)list.private)->pool = acceptNodePool(pool, sizeof(ELEMENT_DOUBLE_LIST));
+            break;
+        default:
+            break;
+    }
+    return list;
+}
 
-    return insert;
+/**
+ *
+ * @details The operations take the list as their first argument, nothing is
+ * kept between calls: list->insert(list).top(list, data, callback).
+ * @param this
+ * @return
+ */
+InsertList _insert_list(List *this){
+    return insert_list;
 }
 
 /**
@@ -345,6 +692,18 @@ void _print_list(List *this, void(*callback)(const void* d)){
             }
             break;
         }
+        case UNROLLED:{
+            struct PrivateDataListUnrolled *private = (struct PrivateDataListUnrolled*)this->private;
+            UnrolledADT unrolledADT;
+            unsigned int i;
+            for(unrolledADT = private->bottom; unrolledADT != NULL; unrolledADT = unrolledADT->next){
+                for(i = 0; i < unrolledADT->count; i++){
+                    if (callback != NULL)
+                        callback(unrolledADT->data[i]);
+                }
+            }
+            break;
+        }
     }
 
 }
@@ -354,7 +713,7 @@ void _print_list(List *this, void(*callback)(const void* d)){
  * @param this
  * @return
  */
-unsigned int _get_size(List *this){
+unsigned int _get_size_list(List *this){
     switch(this->linkType){
         case SIMPLE:{
             struct PrivateDataListSimple *private = (struct PrivateDataListSimple*)this->private;
@@ -364,6 +723,10 @@ unsigned int _get_size(List *this){
             struct PrivateDataListDouble *private = (struct PrivateDataListDouble*)this->private;
             return private->size;
         }
+        case UNROLLED:{
+            struct PrivateDataListUnrolled *private = (struct PrivateDataListUnrolled*)this->private;
+            return private->size;
+        }
         default:{
             return 0;
         }
@@ -373,143 +736,225 @@ unsigned int _get_size(List *this){
 /**
  *
  * @param this
+ * @param callback
  * @return
  */
-DeleteList _delete_list(List *this){
-
-    static List* static_this;
-    static_this = this;
-
-    int top(void(*callback)(const void* d)){
-        switch (static_this->linkType) {
-            case SIMPLE: {
-                struct PrivateDataListSimple *private = (struct PrivateDataListSimple*)static_this->private;
-                if(private->size > 0) {
-                    SimpleADT simpleADT = private->listADT;
-                    int i = 1;
-                    for (i = 1; i < private->size - 1; simpleADT = simpleADT->next, i++);
-                    if (callback != NULL)
-                        callback(simpleADT->data);
-                    free(private->top->data);
-                    free(private->top);
-                    simpleADT->next = NULL;
-                    private->top = simpleADT;
-                    private->size--;
-                    return 1;
-                }
+static int _delete_top_list(List *this, void(*callback)(const void* d)){
+    switch (this->linkType) {
+        case SIMPLE: {
+            struct PrivateDataListSimple *private = (struct PrivateDataListSimple*)this->private;
+            if(private->size == 1) {
+                return this->delete(this).bottom(this, callback);
+            } else if(private->size > 0) {
+                SimpleADT simpleADT = private->listADT;
+                int i = 1;
+                for (i = 1; i < private->size - 1; simpleADT = simpleADT->next, i++);
+                if (callback != NULL)
+                    callback(private->top->data);
+                free(private->top->data);
+                releaseNode(private->pool, private->top);
+                simpleADT->next = NULL;
+                private->top = simpleADT;
+                private->size--;
+                return 1;
             }
-            case DOUBLE: {
-                struct PrivateDataListDouble *private = (struct PrivateDataListDouble*)static_this->private;
-                if(private->size > 0) {
-                    if (callback != NULL)
-                        callback(private->top->data);
-                    private->top->prev->next = NULL;
-                    private->top = private->top->prev;
-                    free(private->top->data);
-                    free(private->top);
-                    private->size--;
-                    return 1;
+            return 0;
+        }
+        case DOUBLE: {
+            struct PrivateDataListDouble *private = (struct PrivateDataListDouble*)this->private;
+            if(private->size > 0) {
+                DoubleADT top = private->top;
+                if (callback != NULL)
+                    callback(top->data);
+                if(private->size == 1) {
+                    private->listADT = private->bottom = private->top = NULL;
+                } else {
+                    private->top = top->prev;
+                    if(this->listType == CIRCULAR) {
+                        private->top->next = private->bottom;
+                        private->bottom->prev = private->top;
+                    } else
+                        private->top->next = NULL;
                 }
+                free(top->data);
+                releaseNode(private->pool, top);
+                private->size--;
+                return 1;
             }
-            default:{
-                return 0;
+            return 0;
+        }
+        case UNROLLED: {
+            struct PrivateDataListUnrolled *private = (struct PrivateDataListUnrolled*)this->private;
+            if(private->size > 0) {
+                void* data = unrolled_delete(private, private->size - 1);
+                if (callback != NULL)
+                    callback(data);
+                free(data);
+                return 1;
             }
+            return 0;
+        }
+        default:{
+            return 0;
         }
     }
+}
 
-    int bottom(void(*callback)(const void* d)){
-        switch (static_this->linkType) {
-            case SIMPLE: {
-                struct PrivateDataListSimple *private = (struct PrivateDataListSimple*)static_this->private;
-                if(private->size > 0) {
+/**
+ *
+ * @param this
+ * @param callback
+ * @return
+ */
+static int _delete_bottom_list(List *this, void(*callback)(const void* d)){
+    switch (this->linkType) {
+        case SIMPLE: {
+            struct PrivateDataListSimple *private = (struct PrivateDataListSimple*)this->private;
+            if(private->size > 0) {
+                if (callback != NULL)
+                    callback(private->bottom->data);
+                private->listADT = private->bottom->next;
+                free(private->bottom->data);
+                releaseNode(private->pool, private->bottom);
+                private->bottom = private->listADT;
+                private->size--;
+                if(private->size == 0)
+                    private->listADT = private->bottom = private->top = NULL;
+                return 1;
+            }
+            return 0;
+        }
+        case DOUBLE: {
+            struct PrivateDataListDouble *private = (struct PrivateDataListDouble*)this->private;
+            if(private->size > 0) {
+                if (callback != NULL)
+                    callback(private->bottom->data);
+                private->listADT = private->bottom->next;
+                free(private->bottom->data);
+                releaseNode(private->pool, private->bottom);
+                private->bottom = private->listADT;
+                private->size--;
+                if(private->size == 0)
+                    private->listADT = private->bottom = private->top = NULL;
+                else if(this->listType == CIRCULAR) {
+                    private->bottom->prev = private->top;
+                    private->top->next = private->bottom;
+                } else
+                    private->bottom->prev = NULL;
+                return 1;
+            }
+            return 0;
+        }
+        case UNROLLED: {
+            struct PrivateDataListUnrolled *private = (struct PrivateDataListUnrolled*)this->private;
+            if(private->size > 0) {
+                void* data = unrolled_delete(private, 0);
+                if (callback != NULL)
+                    callback(data);
+                free(data);
+                return 1;
+            }
+            return 0;
+        }
+        default:{
+            return 0;
+        }
+    }
+}
+
+/**
+ *
+ * @param this
+ * @param p
+ * @param callback
+ * @return
+ */
+static int _delete_pos_list(List *this, unsigned int p, void(*callback)(const void* d)){
+    switch (this->linkType) {
+        case SIMPLE: {
+            struct PrivateDataListSimple *private = (struct PrivateDataListSimple*)this->private;
+            if(private->size > 0) {
+                if (p < 0 || p > private->size) {
+                    return 0;
+                } else if (p == 0) {
+                    return this->delete(this).bottom(this, callback);
+                } else if (p == private->size) {
+                    return this->delete(this).top(this, callback);
+                } else {
+                    SimpleADT simpleADT = private->listADT;
+                    int i = 1;
+                    for (i = 1; i < p; simpleADT = simpleADT->next, i++);
+                    SimpleADT removed = simpleADT->next;
                     if (callback != NULL)
-                        callback(private->bottom->data);
-                    private->listADT = private->bottom->next;
-                    free(private->bottom->data);
-                    free(private->bottom);
-                    private->bottom = private->listADT;
+                        callback(removed->data);
+                    simpleADT->next = removed->next;
+                    if(removed == private->top)
+                        private->top = simpleADT;
+                    free(removed->data);
+                    releaseNode(private->pool, removed);
                     private->size--;
                     return 1;
                 }
             }
-            case DOUBLE: {
-                struct PrivateDataListDouble *private = (struct PrivateDataListDouble*)static_this->private;
-                if(private->size > 0) {
+            return 0;
+        }
+        case DOUBLE: {
+            struct PrivateDataListDouble *private = (struct PrivateDataListDouble*)this->private;
+            if(private->size > 0) {
+                if (p < 0 || p > private->size) {
+                    return 0;
+                } else if (p == 0) {
+                    return this->delete(this).bottom(this, callback);
+                } else if (p == private->size) {
+                    return this->delete(this).top(this, callback);
+                } else {
+                    DoubleADT doubleADT = private->listADT;
+                    int i = 1;
+                    for (i = 1; i < p; doubleADT = doubleADT->next, i++);
+                    DoubleADT removed = doubleADT->next;
                     if (callback != NULL)
-                        callback(private->bottom->data);
-                    private->listADT = private->bottom->next;
-                    free(private->bottom->data);
-                    free(private->bottom);
-                    private->bottom = private->listADT;
+                        callback(removed->data);
+                    doubleADT->next = removed->next;
+                    if(removed == private->top)
+                        private->top = doubleADT;
+                    else
+                        removed->next->prev = doubleADT;
+                    free(removed->data);
+                    releaseNode(private->pool, removed);
                     private->size--;
                     return 1;
                 }
             }
-            default:{
-                return 0;
-            }
+            return 0;
         }
-    }
-    
-    int pos(unsigned int p, void(*callback)(const void* d)){
-        switch (static_this->linkType) {
-            case SIMPLE: {
-                struct PrivateDataListSimple *private = (struct PrivateDataListSimple*)static_this->private;
-                if(private->size > 0) {
-                    if (p < 0 || p > private->size) {
-                        return 0;
-                    } else if (p == 0) {
-                        return static_this->delete(static_this).bottom(callback);
-                    } else if (p == private->size) {
-                        return static_this->delete(static_this).top(callback);
-                    } else {
-                        SimpleADT simpleADT = private->listADT;
-                        int i = 1;
-                        for (i = 1; i < p; simpleADT = simpleADT->next, i++);
-                        if (callback != NULL)
-                            callback(simpleADT->next->data);
-                        free(simpleADT->data);
-                        free(simpleADT->next);
-                        simpleADT->next = simpleADT->next->next;
-                        private->size--;
-                        return 1;
-                    }
-                }
-            }
-            case DOUBLE: {
-                struct PrivateDataListDouble *private = (struct PrivateDataListDouble*)static_this->private;
-                if(private->size > 0) {
-                    if (p < 0 || p > private->size) {
-                        return 0;
-                    } else if (p == 0) {
-                        return static_this->delete(static_this).bottom(callback);
-                    } else if (p == private->size) {
-                        return static_this->delete(static_this).top(callback);
-                    } else {
-                        DoubleADT doubleADT = private->listADT;
-                        int i = 1;
-                        for (i = 1; i < p; doubleADT = doubleADT->next, i++);
-                        if (callback != NULL)
-                            callback(doubleADT->next->data);
-                        free(doubleADT->next->data);
-                        free(doubleADT->next);
-                        doubleADT->next = doubleADT->next->next;
-                        private->size--;
-                        return 1;
-                    }
-                }
+        case UNROLLED: {
+            struct PrivateDataListUnrolled *private = (struct PrivateDataListUnrolled*)this->private;
+            if(private->size > 0 && p <= private->size) {
+                void* data = unrolled_delete(private, p == private->size ? p - 1 : p);
+                if (callback != NULL)
+                    callback(data);
+                free(data);
+                return 1;
             }
+            return 0;
         }
-        return 0;
     }
+    return 0;
+}
 
-    DeleteList deleteList = {
-        .bottom = bottom,
-        .pos = pos,
-        .top = top
-    };
+static const DeleteList delete_list = {
+    .top = _delete_top_list,
+    .bottom = _delete_bottom_list,
+    .pos = _delete_pos_list
+};
 
-    return deleteList;
+/**
+ *
+ * @param this
+ * @return
+ */
+DeleteList _delete_list(List *this){
+    return delete_list;
 }
 
 /**
@@ -518,34 +963,12 @@ DeleteList _delete_list(List *this){
  * @return
  */
 int _empty_list(List *this){
-    switch (this->linkType){
-        case SIMPLE:{
-            struct PrivateDataListSimple *private = (struct PrivateDataListSimple*)this->private;
-            if(private->size > 0){
-                unsigned int i = 0;
-                int r = 1;
-                unsigned  int size = private->size;
-                for(i = 0; i < size; i++){
-                    r = r && this->delete(this).pos(i, NULL);
-                }
-                return 1;
-            }
-        }
-        case DOUBLE:{
-            struct PrivateDataListDouble *private = (struct PrivateDataListDouble*)this->private;
-            if(private->size > 0){
-                unsigned int i = 0;
-                int r = 1;
-                unsigned int size = private->size;
-                for(i = 0; i < size; i++){
-                    r = r && this->delete(this).pos(i, NULL);
-                }
-                return 1;
-            }
-        }
-        default:
-            return 0;
+    if(this->get_size(this) > 0){
+        while(this->get_size(this) > 0)
+            this->delete(this).bottom(this, NULL);
+        return 1;
     }
+    return 0;
 }
 
 /**
@@ -558,92 +981,263 @@ int _empty_list(List *this){
  * @return
  */
 int _update_list(List *this, void *data, unsigned int p, void(*callback_delete)(const void *d), void(*callback_insert)(const void *d)){
-    this->delete(this).pos(p, callback_delete);
-    this->insert(this).pos(p, data, callback_insert);
+    this->delete(this).pos(this, p, callback_delete);
+    this->insert(this).pos(this, p, data, callback_insert);
     return 1;
 }
 
 /**
  *
- * @param list
+ * @param this
+ * @param p
  * @return
  */
-GetList _get_list(List *list){
-    static List *this;
-    this = list;
-
-    void* pos(unsigned int p){
-        switch (this->linkType) {
-            case SIMPLE: {
-                void* data = NULL;
-                struct PrivateDataListSimple *private = (struct PrivateDataListSimple*)this->private;
-                if(private->size > 0) {
-                    SimpleADT simpleADT = private->listADT;
-                    int i;
-                    for (i = 0; i < p; simpleADT = simpleADT->next, i++);
-                    return simpleADT->data;
-                }else{
-                    return data;
-                }
-            }
-            case DOUBLE: {
-                void* data = NULL;
-                struct PrivateDataListDouble *private = (struct PrivateDataListDouble*)this->private;
-                if(private->size > 0) {
-                    DoubleADT doubleADT = private->listADT;
-                    unsigned int size = private->size;
-                    int i;
-                    if(p>size/2){
-                        for (i = 0; i < p; doubleADT = doubleADT->prev, i++);
-                    }else
-                        for (i = 0; i < p; doubleADT = doubleADT->next, i++);
-                    return doubleADT->data;
-                }else{
-                    return data;
-                }
-            }
-            default:
-                return NULL;
-        }
-    }
-
-    void** all(void) {
-        switch (this->linkType) {
-            case SIMPLE: {
-                struct PrivateDataListSimple *private = (struct PrivateDataListSimple*)this->private;
-                void** data  = calloc(private->size , sizeof(void*));
+static void* _get_pos_list(List *this, unsigned int p){
+    switch (this->linkType) {
+        case SIMPLE: {
+            void* data = NULL;
+            struct PrivateDataListSimple *private = (struct PrivateDataListSimple*)this->private;
+            if(private->size > 0) {
                 SimpleADT simpleADT = private->listADT;
-                unsigned int size = private->size;
-                unsigned int i;
-                for(i=0; i< size; i++){
-                    data[i] = simpleADT->data;
-                    simpleADT = simpleADT->next;
-                }
+                int i;
+                for (i = 0; i < p; simpleADT = simpleADT->next, i++);
+                return simpleADT->data;
+            }else{
                 return data;
             }
-            case DOUBLE: {
-                struct PrivateDataListDouble *private = (struct PrivateDataListDouble *) this->private;
-                void **data = calloc(private->size, sizeof(void *));
+        }
+        case DOUBLE: {
+            void* data = NULL;
+            struct PrivateDataListDouble *private = (struct PrivateDataListDouble*)this->private;
+            if(private->size > 0) {
                 DoubleADT doubleADT = private->listADT;
                 unsigned int size = private->size;
-                unsigned int i;
-                for (i = 0; i < size; i++) {
-                    data[i] = doubleADT->data;
-                    doubleADT = doubleADT->next;
-                }
+                int i;
+                if(p>size/2){
+                    doubleADT = private->top;
+                    for (i = size - 1; i > p; doubleADT = doubleADT->prev, i--);
+                }else
+                    for (i = 0; i < p; doubleADT = doubleADT->next, i++);
+                return doubleADT->data;
+            }else{
                 return data;
             }
-            default:
-                return NULL;
         }
+        case UNROLLED: {
+            struct PrivateDataListUnrolled *private = (struct PrivateDataListUnrolled*)this->private;
+            unsigned int offset;
+            if(p < private->size)
+                return unrolled_find(private, p, &offset)->data[offset];
+            return NULL;
+        }
+        default:
+            return NULL;
     }
+}
 
-    GetList getList = {
-        .pos = pos,
-        .all = all
-    };
+/**
+ *
+ * @param this
+ * @return
+ */
+static void** _get_all_list(List *this){
+    switch (this->linkType) {
+        case SIMPLE: {
+            struct PrivateDataListSimple *private = (struct PrivateDataListSimple*)this->private;
+            void** data  = calloc(private->size , sizeof(void*));
+            SimpleADT simpleADT = private->listADT;
+            unsigned int size = private->size;
+            unsigned int i;
+            for(i=0; i< size; i++){
+                data[i] = simpleADT->data;
+                simpleADT = simpleADT->next;
+            }
+            return data;
+        }
+        case DOUBLE: {
+            struct PrivateDataListDouble *private = (struct PrivateDataListDouble *) this->private;
+            void **data = calloc(private->size, sizeof(void *));
+            DoubleADT doubleADT = private->listADT;
+            unsigned int size = private->size;
+            unsigned int i;
+            for (i = 0; i < size; i++) {
+                data[i] = doubleADT->data;
+                doubleADT = doubleADT->next;
+            }
+            return data;
+        }
+        case UNROLLED: {
+            struct PrivateDataListUnrolled *private = (struct PrivateDataListUnrolled *) this->private;
+            void **data = calloc(private->size, sizeof(void *));
+            UnrolledADT unrolledADT;
+            unsigned int i = 0;
+            for (unrolledADT = private->bottom; unrolledADT != NULL; unrolledADT = unrolledADT->next) {
+                memcpy(data + i, unrolledADT->data, unrolledADT->count * sizeof(void *));
+                i += unrolledADT->count;
+            }
+            return data;
+        }
+        default:
+            return NULL;
+    }
+}
+
+static const GetList get_list = {
+    .pos = _get_pos_list,
+    .all = _get_all_list
+};
+
+/**
+ *
+ * @param this
+ * @return
+ */
+GetList _get_list(List *this){
+    return get_list;
+}
+
+/**
+ *
+ * @param this
+ * @param node
+ * @param index
+ * @return cursor on node, or past the end when index is out of the list
+ */
+static ListCursor cursor_at(List *this, void* node, unsigned int index){
+    ListCursor cursor;
+    cursor.index = index;
+    cursor.offset = 0;
+    if(node == NULL || index >= this->get_size(this)){
+        cursor.node = NULL;
+        cursor.data = NULL;
+    }else{
+        cursor.node = node;
+        cursor.data = this->linkType == SIMPLE ? ((SimpleADT)node)->data : ((DoubleADT)node)->data;
+    }
+    return cursor;
+}
+
+/**
+ *
+ * @param chunk
+ * @param offset
+ * @param index
+ * @return cursor on a slot of an unrolled chunk, past the end when chunk is NULL
+ */
+static ListCursor cursor_unrolled(UnrolledADT chunk, unsigned int offset, unsigned int index){
+    ListCursor cursor;
+    cursor.index = index;
+    cursor.offset = offset;
+    cursor.node = chunk;
+    cursor.data = chunk != NULL ? chunk->data[offset] : NULL;
+    return cursor;
+}
+
+/**
+ *
+ * @param this
+ * @return cursor on the first element, node is NULL if the list is empty
+ */
+ListCursor _begin_list(List *this){
+    switch(this->linkType){
+        case SIMPLE:
+            return cursor_at(this, ((struct PrivateDataListSimple*)this->private)->listADT, 0);
+        case UNROLLED:
+            return cursor_unrolled(((struct PrivateDataListUnrolled*)this->private)->bottom, 0, 0);
+        default:
+            return cursor_at(this, ((struct PrivateDataListDouble*)this->private)->listADT, 0);
+    }
+}
 
-    return getList;
+/**
+ *
+ * @param this
+ * @return cursor on the last element, node is NULL if the list is empty
+ */
+ListCursor _last_list(List *this){
+    unsigned int size = this->get_size(this);
+    switch(this->linkType){
+        case SIMPLE:
+            return cursor_at(this, ((struct PrivateDataListSimple*)this->private)->top, size - 1);
+        case UNROLLED:{
+            UnrolledADT top = ((struct PrivateDataListUnrolled*)this->private)->top;
+            return cursor_unrolled(top, top != NULL ? top->count - 1 : 0, size - 1);
+        }
+        default:
+            return cursor_at(this, ((struct PrivateDataListDouble*)this->private)->top, size - 1);
+    }
+}
+
+/**
+ *
+ * @details The walk counts elements, so it stops after the last one of a
+ * circular list too.
+ * @param this
+ * @param cursor
+ * @return 1 if the cursor is on an element after moving
+ */
+int _next_list(List *this, ListCursor *cursor){
+    if(cursor->node == NULL)
+        return 0;
+    if(this->linkType == UNROLLED){
+        UnrolledADT chunk = (UnrolledADT)cursor->node;
+        if(cursor->offset + 1 < chunk->count)
+            *cursor = cursor_unrolled(chunk, cursor->offset + 1, cursor->index + 1);
+        else
+            *cursor = cursor_unrolled(chunk->next, 0, cursor->index + 1);
+    }else if(this->linkType == SIMPLE)
+        *cursor = cursor_at(this, ((SimpleADT)cursor->node)->next, cursor->index + 1);
+    else
+        *cursor = cursor_at(this, ((DoubleADT)cursor->node)->next, cursor->index + 1);
+    return cursor->node != NULL;
+}
+
+/**
+ *
+ * @details O(1) on a double list, a simple list has no back links and is
+ * walked again from the start.
+ * @param this
+ * @param cursor
+ * @return 1 if the cursor is on an element after moving
+ */
+int _prev_list(List *this, ListCursor *cursor){
+    if(cursor->node == NULL || cursor->index == 0){
+        cursor->node = NULL;
+        cursor->data = NULL;
+        return 0;
+    }
+    if(this->linkType == SIMPLE){
+        SimpleADT simpleADT = ((struct PrivateDataListSimple*)this->private)->listADT;
+        unsigned int i;
+        for(i = 0; i < cursor->index - 1; i++)
+            simpleADT = simpleADT->next;
+        *cursor = cursor_at(this, simpleADT, cursor->index - 1);
+    }else if(this->linkType == UNROLLED){
+        UnrolledADT chunk = (UnrolledADT)cursor->node;
+        if(cursor->offset > 0)
+            *cursor = cursor_unrolled(chunk, cursor->offset - 1, cursor->index - 1);
+        else
+            *cursor = cursor_unrolled(chunk->prev, chunk->prev->count - 1, cursor->index - 1);
+    }else{
+        *cursor = cursor_at(this, ((DoubleADT)cursor->node)->prev, cursor->index - 1);
+    }
+    return cursor->node != NULL;
+}
+
+/**
+ *
+ * @param this
+ * @param callback gets every element in order with context, returns 0 to stop
+ * @param context
+ * @return 1 if the callback stopped the walk
+ */
+int _foreach_list(List *this, int(*callback)(void* data, void* context), void* context){
+    ListCursor cursor;
+    for(cursor = _begin_list(this); cursor.node != NULL; _next_list(this, &cursor)){
+        if(!callback(cursor.data, context))
+            return 1;
+    }
+    return 0;
 }
 
 /**
@@ -4,6 +4,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdarg.h>
+#include <string.h>
+#include "../pool/node_pool.h"
 
 #ifdef  __cplusplus
 extern "C" {
@@ -11,6 +13,7 @@ extern "C" {
 typedef struct List List;
 typedef struct DoubleADT* DoubleADT, ELEMENT_DOUBLE_LIST;
 typedef struct SimpleADT* SimpleADT, ELEMENT_SIMPLE_LIST;
+typedef struct UnrolledADT* UnrolledADT, ELEMENT_UNROLLED_LIST;
 struct SimpleADT{
     void* data;
     SimpleADT next;
@@ -22,14 +25,27 @@ struct DoubleADT{
     DoubleADT next;
 };
 
+/**
+ * Chunk of an unrolled list: up to capacity consecutive elements.
+ */
+struct UnrolledADT{
+    UnrolledADT prev;
+    UnrolledADT next;
+    unsigned int count;
+    void* data[];
+};
+
 typedef enum ListType{ LINEAL, CIRCULAR }ListType;
-typedef enum LinkType{ SIMPLE, DOUBLE }LinkType;
+typedef enum LinkType{ SIMPLE, DOUBLE, UNROLLED }LinkType;
+
+#define LIST_UNROLLED_MIN_CAPACITY 16
 
 typedef struct PrivateDataListSimple{
     SimpleADT bottom;
     SimpleADT top;
     SimpleADT listADT;
     unsigned int size;
+    NodePool* pool;//NULL for malloc
 };
 
 typedef struct PrivateDataListDouble{
@@ -37,25 +53,55 @@ typedef struct PrivateDataListDouble{
     DoubleADT top;
     DoubleADT listADT;
     unsigned int size;
+    NodePool* pool;//NULL for malloc
 };
 
+/**
+ * Unrolled list (always lineal): chunks keep capacity elements at most, a
+ * position is found by skipping whole chunks by their count. The capacity
+ * follows sqrt(size), repacking when size leaves [capacity^2/8, 2*capacity^2],
+ * so get.pos, insert.pos and delete.pos are O(sqrt(n)).
+ */
+typedef struct PrivateDataListUnrolled{
+    UnrolledADT bottom;
+    UnrolledADT top;
+    unsigned int capacity;
+    unsigned int size;
+}PrivateDataListUnrolled;
+
 typedef struct {
-    int (*const top)(const void* data_to_insert, void(*callback)(const void* d));
-    int (*const bottom)(const void* data_to_insert, void(*callback)(const void* d));
-    int (*const pos)(unsigned int p, const void* data_to_insert, void(*callback)(const void* d));
+    int (*const top)(List *this, const void* data_to_insert, void(*callback)(const void* d));
+    int (*const bottom)(List *this, const void* data_to_insert, void(*callback)(const void* d));
+    int (*const pos)(List *this, unsigned int p, const void* data_to_insert, void(*callback)(const void* d));
 }InsertList;
 
 typedef struct {
-    int (*const top)(void(*callback)(const void* d));
-    int (*const bottom)(void(*callback)(const void* d));
-    int (*const pos)(unsigned int p, void(*callback)(const void* d));
+    int (*const top)(List *this, void(*callback)(const void* d));
+    int (*const bottom)(List *this, void(*callback)(const void* d));
+    int (*const pos)(List *this, unsigned int p, void(*callback)(const void* d));
 }DeleteList;
 
 typedef struct{
-    void* (*const pos)(unsigned int p);
-    void** (*const all)(void);
+    void* (*const pos)(List *this, unsigned int p);
+    void** (*const all)(List *this);
 }GetList;
 
+/**
+ * Position in a list, walked in place without copying: node is the
+ * SimpleADT/DoubleADT under the cursor and NULL once past either end.
+ * Inserting or deleting invalidates the cursors of the list.
+ *
+ *     ListCursor c;
+ *     for(c = list->begin(list); c.node != NULL; list->next(list, &c))
+ *         use(c.data);
+ */
+typedef struct ListCursor{
+    void* node;
+    void* data;
+    unsigned int index;
+    unsigned int offset;//slot in an unrolled chunk
+}ListCursor;
+
 
 typedef struct List{
     ListType listType;
@@ -67,19 +113,30 @@ typedef struct List{
     int (*empty)(List *this);
     DeleteList (*delete)(List *this);
     int (*update)(List *this, void *data, unsigned int pos, void(*callback_delete)(const void *d), void(*callback_insert)(const void *d));
-    GetList (*get)(List *list);
+    GetList (*get)(List *this);
+    ListCursor (*begin)(List *this);
+    ListCursor (*last)(List *this);
+    int (*next)(List *this, ListCursor *cursor);
+    int (*prev)(List *this, ListCursor *cursor);
+    int (*foreach)(List *this, int(*callback)(void* data, void* context), void* context);
 };
 
 List* newListPtr(ListType listType, LinkType linkType);
 List newList(ListType list_type, LinkType linkType);
+List newPooledList(ListType listType, LinkType linkType, NodePool *pool);
 void destroyList(List *list);
 static InsertList _insert_list(List *this);
 static void _print_list(List *this, void(*callback)(const void* d));
-static unsigned int _get_size(List *this);
+static unsigned int _get_size_list(List *this);
 static DeleteList _delete_list(List *this);
 static int _empty_list(List *this);
 static int _update_list(List *this, void *data, unsigned int pos, void(*callback_delete)(const void *d), void(*callback_insert)(const void *d));
-static GetList _get_list(List *list);
+static GetList _get_list(List *this);
+static ListCursor _begin_list(List *this);
+static ListCursor _last_list(List *this);
+static int _next_list(List *this, ListCursor *cursor);
+static int _prev_list(List *this, ListCursor *cursor);
+static int _foreach_list(List *this, int(*callback)(void* data, void* context), void* context);
 
 #ifdef  __cplusplus
 }
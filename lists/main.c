@@ -2,6 +2,11 @@
 // Created by regoeco on 29/12/16.
 //
 #include "list.h"
+
+#define CHECK_OPERATIONS 20000
+#define CHURN_ROUNDS 32
+#define CHURN_ITEMS 1000
+
 //INTERFACE OF CALLBACKS
 void callback_insert(const void*);
 void callback_delete(const void*);
@@ -11,69 +16,207 @@ void callback_print(const void* d);
 typedef struct {
     int number;
 } struct_number;
-//MAIN
-int main(int argc, char** argv)
-{
-    //DATA TO INSERT
-    struct_number n[10];
-    int i = 0;
 
-    //INSTANCE= newList(LINEAL || DOUBLE, SIMPLE || CIRCULAR);
-    List list = newList(LINEAL, DOUBLE);
+/**
+ *
+ * @details The list frees its data on delete, so every element is malloc'd.
+ * @param number
+ * @return
+ */
+struct_number* new_number(int number){
+    struct_number *n = malloc(sizeof(struct_number));
+    n->number = number;
+    return n;
+}
 
-    //list.this->delete()
+/**
+ *
+ * @param state
+ * @param bound
+ * @return in [0, bound)
+ */
+unsigned int next_random(unsigned int *state, unsigned int bound){
+    *state = *state*1103515245u + 12345u;
+    return (*state >> 8) % bound;
+}
 
+/**
+ *
+ * @details Replays random insert.pos, delete.pos and get.pos on an UNROLLED
+ * list and on an array; the list grows past a few repacks, then is drained.
+ * @param seed
+ * @return number of mismatches
+ */
+int check_unrolled(unsigned int seed){
+    List list = newList(LINEAL, UNROLLED);
+    int *expected = malloc(CHECK_OPERATIONS*sizeof(int));
+    unsigned int size = 0, state = seed, i, p;
+    int errors = 0;
+
+    for(i = 0; i < 2*CHECK_OPERATIONS; i++){
+        unsigned int operation = next_random(&state, 10);
+        if(i >= CHECK_OPERATIONS)
+            operation = size > 0 ? 6 + operation%4 : 0;
+        if(operation < 6 && size < CHECK_OPERATIONS){
+            //INSERT
+            p = next_random(&state, size + 1);
+            if(!list.insert(&list).pos(&list, p, new_number((int)i), NULL))
+                errors++;
+            memmove(&expected[p + 1], &expected[p], (size - p)*sizeof(int));
+            expected[p] = (int)i;
+            size++;
+        }else if(operation < 8 && size > 0){
+            //DELETE
+            p = next_random(&state, size);
+            if(!list.delete(&list).pos(&list, p, NULL))
+                errors++;
+            memmove(&expected[p], &expected[p + 1], (size - p - 1)*sizeof(int));
+            size--;
+        }else if(size > 0){
+            //GET
+            p = next_random(&state, size);
+            struct_number *data = (struct_number*)list.get(&list).pos(&list, p);
+            if(data == NULL || data->number != expected[p]){
+                printf("ERROR UNROLLED OPERATION %u: get.pos(%u) = %d, array = %d\n",
+                       i, p, data != NULL ? data->number : -1, expected[p]);
+                errors++;
+            }
+        }
+        if(list.get_size(&list) != size){
+            printf("ERROR UNROLLED OPERATION %u: size %u, array %u\n", i, list.get_size(&list), size);
+            errors++;
+            break;
+        }
+    }
+    for(p = 0; p < size; p++){
+        struct_number *data = (struct_number*)list.get(&list).pos(&list, p);
+        if(data == NULL || data->number != expected[p])
+            errors++;
+    }
 
+    free(expected);
+    destroyList(&list);
+    return errors;
+}
 
+/**
+ *
+ * @details insert.top(1), insert.top(2), delete.bottom, delete.top: the
+ * second delete used to follow the prev link to the freed bottom.
+ * @param listType
+ * @return number of mismatches
+ */
+int check_double(ListType listType){
+    List list = newList(listType, DOUBLE);
+    int errors = 0;
+    list.insert(&list).top(&list, new_number(1), NULL);
+    list.insert(&list).top(&list, new_number(2), NULL);
+    list.delete(&list).bottom(&list, NULL);
+    struct_number *data = (struct_number*)list.get(&list).pos(&list, 0);
+    if(data == NULL || data->number != 2)
+        errors++;
+    list.delete(&list).top(&list, NULL);
+    if(list.get_size(&list) != 0)
+        errors++;
+    //THE EMPTIED LIST IS STILL USABLE
+    list.insert(&list).top(&list, new_number(3), NULL);
+    list.insert(&list).bottom(&list, new_number(4), NULL);
+    list.delete(&list).top(&list, NULL);
+    data = (struct_number*)list.get(&list).pos(&list, 0);
+    if(list.get_size(&list) != 1 || data == NULL || data->number != 4)
+        errors++;
+    if(errors > 0)
+        printf("ERROR DOUBLE %s: delete.bottom then delete.top\n", listType == CIRCULAR ? "CIRCULAR" : "LINEAL");
+    destroyList(&list);
+    return errors;
+}
 
-    for(i = 0; i <10; i++) {
-        n[i].number = i * i;
-        list.insert(&list).top(&n[i], NULL);
+/**
+ *
+ * @details Inserts and deletes CHURN_ITEMS numbers a round through a pooled
+ * list; deleted nodes must be reused, never carved again.
+ * @param linkType SIMPLE or DOUBLE
+ * @param pool
+ * @return number of mismatches
+ */
+int churn_pooled(LinkType linkType, NodePool *pool){
+    unsigned int slabs = 0;
+    int round, i, errors = 0;
+    for(round = 0; round < CHURN_ROUNDS; round++){
+        List list = newPooledList(LINEAL, linkType, pool);
+        for(i = 0; i < CHURN_ITEMS; i++)
+            list.insert(&list).top(&list, new_number(i), NULL);
+        for(i = 0; i < CHURN_ITEMS; i++){
+            struct_number *data = (struct_number*)list.get(&list).pos(&list, 0);
+            if(data == NULL || data->number != i)
+                errors++;
+            list.delete(&list).bottom(&list, NULL);
+        }
+        destroyList(&list);
+        if(round == 0)
+            slabs = pool->get_num_slabs(pool);
     }
-    //list.insert(&list).pos(0, &n[9], NULL);
-    //printf("\nSize:%ld", list.get_size(&list));
+    if(pool->get_num_slabs(pool) != slabs)
+        errors++;
+    return errors;
+}
 
-    //list.insert.top(data, callback)
+//MAIN
+int main(int argc, char** argv)
+{
+    int i = 0, errors = 0;
+
+    //INSTANCE= newList(LINEAL || DOUBLE, SIMPLE || CIRCULAR);
+    List list = newList(LINEAL, DOUBLE);
 
+    //list.insert.top(data, callback)
     //list.insert.bottom(data, callback)
     //list.insert.pos(int, data, callback)
+    for(i = 0; i <10; i++)
+        list.insert(&list).top(&list, new_number(i * i), NULL);
 
     list.print(&list, callback_print);
-    //list.delete(&list).pos(5, NULL);
-    //list.insert(&list).pos(5, &n[0], NULL);
-    list.update(&list, &n[0], 5, NULL, NULL);
-    //list.delete(&list).top(NULL);
-    //list.delete(&list).bottom(NULL);
+    list.update(&list, new_number(0), 5, NULL, NULL);
     printf("\n");
-    struct_number** d = (struct_number**)list.get(&list).all();
+    struct_number** d = (struct_number**)list.get(&list).all(&list);
     unsigned int size = list.get_size(&list);
-    //int i;
     for(i = 0; i<size; i++){
-        printf("%d --> ", *d[i]);
+        printf("%d --> ", d[i]->number);
     }
-    struct_number* data = (struct_number*) list.get(&list).pos(5);
-    printf("\nposition 5 = %d", *data);
-
+    struct_number* data = (struct_number*) list.get(&list).pos(&list, 5);
+    printf("\nposition 5 = %d\n", data->number);
 
     list.print(&list, callback_print);
+    printf("\n");
     free(d);
     destroyList(&list);
 
-    return (EXIT_SUCCESS);
+    //UNROLLED AGAINST AN ARRAY
+    errors += check_unrolled(1);
+    errors += check_double(LINEAL) + check_double(CIRCULAR);
+
+    //POOLED CHURN
+    NodePool pool = newNodePool(sizeof(ELEMENT_DOUBLE_LIST), 0);
+    errors += churn_pooled(SIMPLE, &pool) + churn_pooled(DOUBLE, &pool);
+    printf("Slabs:%u ", pool.get_num_slabs(&pool));
+    destroyNodePool(&pool);
+    printf("Errors:%d\n", errors);
+
+    return errors == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
 }
 
 
 void callback_insert(const void* new_data) {
-    struct_number *s = new_data;
+    const struct_number *s = new_data;
     printf("Data to insert: %d.\n", s->number);
 }
 
 void callback_delete(const void* delete_data) {
-    struct_number *s = delete_data;
+    const struct_number *s = delete_data;
     printf("Data to delete:  %d.\n", s->number);
 }
 
 void callback_print(const void* d) {
-    struct_number *s = d;
+    const struct_number *s = d;
     printf("(%d) --> ",s->number);
 }
@@ -0,0 +1,306 @@
+#include "node_pool.h"
+
+typedef struct NodePoolCache{
+    unsigned long pool_id;//0 for a free slot
+    void* nodes;
+    unsigned int count;
+}NodePoolCache;
+
+static _Thread_local NodePoolCache caches[NODE_POOL_CACHE_SLOTS];
+static pthread_mutex_t registry_lock = PTHREAD_MUTEX_INITIALIZER;
+static PrivateDataNodePool* registry = NULL;
+static unsigned long next_pool_id = 1;
+static pthread_once_t caches_once = PTHREAD_ONCE_INIT;
+static pthread_key_t caches_key;
+
+/**
+ *
+ * @param node_size bytes per node, rounded up to the alignment of max_align_t
+ * @param slab_nodes nodes per slab, 0 for NODE_POOL_SLAB_NODES
+ * @return NodePool
+ */
+NodePool newNodePool(size_t node_size, unsigned int slab_nodes){
+    PrivateDataNodePool *p = malloc(sizeof(PrivateDataNodePool));
+    size_t align = _Alignof(max_align_t);
+    if(node_size < sizeof(void*))
+        node_size = sizeof(void*);
+    p->node_size = (node_size + align - 1)/align*align;
+    p->slab_nodes = slab_nodes > 0 ? slab_nodes : NODE_POOL_SLAB_NODES;
+    pthread_mutex_init(&p->lock, NULL);
+    p->free_list = NULL;
+    p->slabs = NULL;
+    p->carved = p->slab_nodes;
+    p->num_slabs = 0;
+
+    pthread_mutex_lock(&registry_lock);
+    p->id = next_pool_id++;
+    p->next_pool = registry;
+    registry = p;
+    pthread_mutex_unlock(&registry_lock);
+
+    NodePool pool = {
+        .private = p,
+        .get_node_size = _get_node_size_node_pool,
+        .get_num_slabs = _get_num_slabs_node_pool,
+        .alloc = _alloc_node_pool,
+        .release = _release_node_pool
+    };
+    return pool;
+}
+
+/**
+ *
+ * @details Frees every slab, nodes still held by containers included.
+ * @param this
+ */
+void destroyNodePool(NodePool *this){
+    PrivateDataNodePool *private = (PrivateDataNodePool*)this->private;
+    PrivateDataNodePool **p;
+    NodeSlab *slab;
+    unsigned int i;
+
+    pthread_mutex_lock(&registry_lock);
+    for(p = &registry; *p != NULL; p = &(*p)->next_pool){
+        if(*p == private){
+            *p = private->next_pool;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&registry_lock);
+
+    for(i = 0; i < NODE_POOL_CACHE_SLOTS; i++){
+        if(caches[i].pool_id == private->id){
+            caches[i].pool_id = 0;
+            caches[i].nodes = NULL;
+            caches[i].count = 0;
+        }
+    }
+    while(private->slabs != NULL){
+        slab = private->slabs;
+        private->slabs = slab->next;
+        free(slab);
+    }
+    pthread_mutex_destroy(&private->lock);
+    free(private);
+}
+
+/**
+ *
+ * @details Containers call it from their constructors, a pool whose nodes
+ * are too small is ignored.
+ * @param pool may be NULL
+ * @param node_size
+ * @return pool, or NULL to use malloc
+ */
+NodePool* acceptNodePool(NodePool *pool, size_t node_size){
+    if(pool != NULL && pool->get_node_size(pool) >= node_size)
+        return pool;
+    return NULL;
+}
+
+/**
+ *
+ * @param pool from acceptNodePool, NULL for malloc
+ * @param node_size
+ * @return
+ */
+void* allocNode(NodePool *pool, size_t node_size){
+    return pool != NULL ? pool->alloc(pool) : malloc(node_size);
+}
+
+/**
+ *
+ * @param pool the node was allocated from, NULL for free
+ * @param node
+ */
+void releaseNode(NodePool *pool, void* node){
+    if(pool != NULL)
+        pool->release(pool, node);
+    else
+        free(node);
+}
+
+/**
+ *
+ * @param pool
+ * @param cache
+ * @param count nodes moved from the cache to the free list of pool
+ */
+static void flush_cache(PrivateDataNodePool *pool, NodePoolCache *cache, unsigned int count){
+    void *first = cache->nodes, *last = cache->nodes;
+    unsigned int i;
+    if(count == 0)
+        return;
+    for(i = 1; i < count; i++)
+        last = *(void**)last;
+    cache->nodes = *(void**)last;
+    cache->count -= count;
+    pthread_mutex_lock(&pool->lock);
+    *(void**)last = pool->free_list;
+    pool->free_list = first;
+    pthread_mutex_unlock(&pool->lock);
+}
+
+/**
+ *
+ * @details Hands the nodes of an evicted cache back to its pool, if the
+ * pool was destroyed meanwhile they are not touched.
+ * @param cache
+ */
+static void evict_cache(NodePoolCache *cache){
+    PrivateDataNodePool *pool;
+    pthread_mutex_lock(&registry_lock);
+    for(pool = registry; pool != NULL && pool->id != cache->pool_id; pool = pool->next_pool);
+    if(pool != NULL)
+        flush_cache(pool, cache, cache->count);
+    pthread_mutex_unlock(&registry_lock);
+}
+
+/**
+ *
+ * @details Destructor of caches_key: an exiting thread hands the nodes of
+ * its caches back to their pools.
+ * @param thread_caches caches of the exiting thread
+ */
+static void flush_thread_caches(void* thread_caches){
+    NodePoolCache *cache = (NodePoolCache*)thread_caches;
+    unsigned int i;
+    for(i = 0; i < NODE_POOL_CACHE_SLOTS; i++){
+        if(cache[i].pool_id != 0)
+            evict_cache(&cache[i]);
+        cache[i].pool_id = 0;
+        cache[i].nodes = NULL;
+        cache[i].count = 0;
+    }
+}
+
+static void create_caches_key(void){
+    pthread_key_create(&caches_key, flush_thread_caches);
+}
+
+/**
+ *
+ * @details Any slot can hold any pool: the slot of the pool is looked up
+ * among all of them, else a free slot is taken, else the slots are evicted
+ * in turn, flushing the nodes back to the pool that held the slot.
+ * @param private
+ * @return cache of the calling thread for the pool
+ */
+static NodePoolCache* cache_of(PrivateDataNodePool *private){
+    static _Thread_local unsigned int victim = 0;
+    NodePoolCache *cache = NULL;
+    unsigned int i;
+    for(i = 0; i < NODE_POOL_CACHE_SLOTS; i++){
+        if(caches[i].pool_id == private->id)
+            return &caches[i];
+        if(caches[i].pool_id == 0 && cache == NULL)
+            cache = &caches[i];
+    }
+    if(cache == NULL){
+        cache = &caches[victim++ % NODE_POOL_CACHE_SLOTS];
+        evict_cache(cache);
+    }
+    pthread_once(&caches_once, create_caches_key);
+    if(pthread_getspecific(caches_key) == NULL)
+        pthread_setspecific(caches_key, caches);
+    cache->pool_id = private->id;
+    cache->nodes = NULL;
+    cache->count = 0;
+    return cache;
+}
+
+/**
+ *
+ * @details Takes half a cache of nodes from the free list, then from the
+ * newest slab, adding a slab when it is used up.
+ * @param private
+ * @param cache
+ */
+static void refill_cache(PrivateDataNodePool *private, NodePoolCache *cache){
+    unsigned int want = NODE_POOL_CACHE_SIZE/2;
+    pthread_mutex_lock(&private->lock);
+    while(cache->count < want && private->free_list != NULL){
+        void* node = private->free_list;
+        private->free_list = *(void**)node;
+        *(void**)node = cache->nodes;
+        cache->nodes = node;
+        cache->count++;
+    }
+    while(cache->count < want){
+        void* node;
+        if(private->carved == private->slab_nodes){
+            NodeSlab *slab = malloc(sizeof(NodeSlab) + private->node_size*private->slab_nodes);
+            if(slab == NULL)
+                break;
+            slab->next = private->slabs;
+            private->slabs = slab;
+            private->carved = 0;
+            private->num_slabs++;
+        }
+        node = (unsigned char*)private->slabs->align + private->node_size*private->carved++;
+        *(void**)node = cache->nodes;
+        cache->nodes = node;
+        cache->count++;
+    }
+    pthread_mutex_unlock(&private->lock);
+}
+
+/**
+ *
+ * @param this
+ * @return
+ */
+size_t _get_node_size_node_pool(NodePool *this){
+    PrivateDataNodePool *private = (PrivateDataNodePool*)this->private;
+    return private->node_size;
+}
+
+/**
+ *
+ * @param this
+ * @return
+ */
+unsigned int _get_num_slabs_node_pool(NodePool *this){
+    PrivateDataNodePool *private = (PrivateDataNodePool*)this->private;
+    unsigned int num_slabs;
+    pthread_mutex_lock(&private->lock);
+    num_slabs = private->num_slabs;
+    pthread_mutex_unlock(&private->lock);
+    return num_slabs;
+}
+
+/**
+ *
+ * @param this
+ * @return node of get_node_size bytes, NULL if out of memory
+ */
+void* _alloc_node_pool(NodePool *this){
+    PrivateDataNodePool *private = (PrivateDataNodePool*)this->private;
+    NodePoolCache *cache = cache_of(private);
+    void* node;
+    if(cache->count == 0)
+        refill_cache(private, cache);
+    if(cache->count == 0)
+        return NULL;
+    node = cache->nodes;
+    cache->nodes = *(void**)node;
+    cache->count--;
+    return node;
+}
+
+/**
+ *
+ * @details Any thread may release a node, it goes to that thread's cache.
+ * @param this
+ * @param node
+ */
+void _release_node_pool(NodePool *this, void* node){
+    PrivateDataNodePool *private = (PrivateDataNodePool*)this->private;
+    NodePoolCache *cache = cache_of(private);
+    if(node == NULL)
+        return;
+    *(void**)node = cache->nodes;
+    cache->nodes = node;
+    if(++cache->count == NODE_POOL_CACHE_SIZE)
+        flush_cache(private, cache, NODE_POOL_CACHE_SIZE/2);
+}
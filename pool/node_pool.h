@@ -0,0 +1,70 @@
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <pthread.h>
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+/**
+ * Fixed-size node allocator. Nodes are carved from slabs of slab_nodes
+ * nodes and released nodes go to a free list, slabs are only returned to
+ * the system by destroyNodePool, all at once. Each thread keeps a small
+ * cache of free nodes per pool, so alloc and release take the pool lock
+ * once every NODE_POOL_CACHE_SIZE/2 calls. The cache is tagged with the
+ * id of its pool, a cache left by a destroyed pool is dropped, never used.
+ * A thread that exits hands its cached nodes back to their pools, a thread
+ * that never exits, like main, keeps them cached until the pool is destroyed.
+ *
+ * A pool can be shared by several containers and threads, it must outlive
+ * the containers built on it.
+ */
+#define NODE_POOL_SLAB_NODES 1024
+#define NODE_POOL_CACHE_SIZE 64
+#define NODE_POOL_CACHE_SLOTS 4//pools cached at the same time by a thread
+
+typedef struct NodePool NodePool;
+
+typedef struct NodeSlab{
+    struct NodeSlab* next;
+    max_align_t align[];
+}NodeSlab;
+
+typedef struct PrivateDataNodePool{
+    unsigned long id;
+    size_t node_size;
+    unsigned int slab_nodes;
+    pthread_mutex_t lock;
+    void* free_list;//released nodes, linked through their first word
+    NodeSlab* slabs;
+    unsigned int carved;//nodes handed out of the newest slab
+    unsigned int num_slabs;
+    struct PrivateDataNodePool* next_pool;//registry of live pools
+}PrivateDataNodePool;
+
+struct NodePool{
+    void* const private;
+    size_t (*const get_node_size)(NodePool *this);
+    unsigned int (*const get_num_slabs)(NodePool *this);
+    void* (*const alloc)(NodePool *this);
+    void (*const release)(NodePool *this, void* node);
+};
+
+NodePool newNodePool(size_t node_size, unsigned int slab_nodes);
+void destroyNodePool(NodePool *this);
+NodePool* acceptNodePool(NodePool *pool, size_t node_size);
+void* allocNode(NodePool *pool, size_t node_size);
+void releaseNode(NodePool *pool, void* node);
+static size_t _get_node_size_node_pool(NodePool *this);
+static unsigned int _get_num_slabs_node_pool(NodePool *this);
+static void* _alloc_node_pool(NodePool *this);
+static void _release_node_pool(NodePool *this, void* node);
+
+#ifdef	__cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,197 @@
+#include <time.h>
+#include <errno.h>
+#include "blocking_queue.h"
+
+/**
+ *
+ * @param high_water size at which producers block, 0 for no limit
+ * @param low_water size at which blocked producers go on, below high_water
+ * @return BlockingQueue
+ */
+BlockingQueue newBlockingQueue(unsigned int high_water, unsigned int low_water){
+    PrivateDataBlockingQueue* p = malloc(sizeof(PrivateDataBlockingQueue));
+    pthread_condattr_t attr;
+    Queue queue = newRingQueue(QUEUE_RING_CAPACITY);
+    memcpy(&p->queue, &queue, sizeof(Queue));
+    pthread_mutex_init(&p->lock, NULL);
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&p->not_empty, &attr);
+    pthread_cond_init(&p->not_full, &attr);
+    pthread_condattr_destroy(&attr);
+    p->high_water = high_water > 0 ? high_water : 0xFFFFFFFFu;
+    p->low_water = low_water < p->high_water ? low_water : p->high_water - 1;
+    p->full = 0;
+    p->closed = 0;
+    BlockingQueue q = {
+        .private = p,
+        .get_size = _get_size_blocking_queue,
+        .enqueue = _enqueue_blocking_queue,
+        .try_enqueue = _try_enqueue_blocking_queue,
+        .dequeue = _dequeue_blocking_queue,
+        .dequeue_batch = _dequeue_batch_blocking_queue,
+        .close = _close_blocking_queue
+    };
+    return q;
+}
+
+/**
+ *
+ * @details No thread may be waiting on the queue.
+ * @param this
+ */
+void destroyBlockingQueue(BlockingQueue *this){
+    PrivateDataBlockingQueue *private = (PrivateDataBlockingQueue*)this->private;
+    destroyQueue(&private->queue);
+    pthread_mutex_destroy(&private->lock);
+    pthread_cond_destroy(&private->not_empty);
+    pthread_cond_destroy(&private->not_full);
+    free(private);
+}
+
+/**
+ *
+ * @param deadline
+ * @param timeout milliseconds from now
+ */
+static void make_deadline(struct timespec *deadline, long timeout){
+    clock_gettime(CLOCK_MONOTONIC, deadline);
+    deadline->tv_sec += timeout/1000;
+    deadline->tv_nsec += (timeout%1000)*1000000L;
+    if(deadline->tv_nsec >= 1000000000L){
+        deadline->tv_sec++;
+        deadline->tv_nsec -= 1000000000L;
+    }
+}
+
+/**
+ *
+ * @details Appends d, must hold the lock and have room.
+ * @param private
+ * @param d
+ * @return
+ */
+static int put(PrivateDataBlockingQueue *private, const void* d){
+    Queue *queue = &private->queue;
+    if(!queue->enqueue(queue, d, NULL))
+        return 0;
+    if(queue->get_size(queue) == 1)
+        pthread_cond_signal(&private->not_empty);
+    if(queue->get_size(queue) >= private->high_water)
+        private->full = 1;
+    return 1;
+}
+
+/**
+ *
+ * @details Blocks while the queue is over its high water mark.
+ * @param this
+ * @param d
+ * @return 0 if the queue is closed
+ */
+int _enqueue_blocking_queue(BlockingQueue *this, const void* d){
+    PrivateDataBlockingQueue *private = (PrivateDataBlockingQueue*)this->private;
+    int r = 0;
+    pthread_mutex_lock(&private->lock);
+    while(private->full && !private->closed)
+        pthread_cond_wait(&private->not_full, &private->lock);
+    if(!private->closed)
+        r = put(private, d);
+    pthread_mutex_unlock(&private->lock);
+    return r;
+}
+
+/**
+ *
+ * @param this
+ * @param d
+ * @return 0 if the queue is over its high water mark or closed
+ */
+int _try_enqueue_blocking_queue(BlockingQueue *this, const void* d){
+    PrivateDataBlockingQueue *private = (PrivateDataBlockingQueue*)this->private;
+    int r = 0;
+    pthread_mutex_lock(&private->lock);
+    if(!private->full && !private->closed)
+        r = put(private, d);
+    pthread_mutex_unlock(&private->lock);
+    return r;
+}
+
+/**
+ *
+ * @details Waits up to timeout milliseconds (BLOCKING_QUEUE_WAIT_FOREVER to
+ * wait until an element comes or the queue is closed, 0 not to wait), then
+ * takes up to max elements at once.
+ * @param this
+ * @param out room for max void*, the front is written first
+ * @param max
+ * @param timeout
+ * @return elements taken, 0 on timeout or once closed and empty
+ */
+unsigned int _dequeue_batch_blocking_queue(BlockingQueue *this, void** out, unsigned int max, long timeout){
+    PrivateDataBlockingQueue *private = (PrivateDataBlockingQueue*)this->private;
+    Queue *queue = &private->queue;
+    struct timespec deadline;
+    unsigned int n;
+    if(max == 0)
+        return 0;
+    if(timeout > 0)
+        make_deadline(&deadline, timeout);
+    pthread_mutex_lock(&private->lock);
+    while(queue->get_size(queue) == 0 && !private->closed && timeout != 0){
+        if(timeout < 0){
+            pthread_cond_wait(&private->not_empty, &private->lock);
+        }else if(pthread_cond_timedwait(&private->not_empty, &private->lock, &deadline) == ETIMEDOUT){
+            break;
+        }
+    }
+    n = queue->dequeue_n(queue, out, max);
+    if(queue->get_size(queue) > 0)
+        pthread_cond_signal(&private->not_empty);//left over for another consumer
+    if(private->full && queue->get_size(queue) <= private->low_water){
+        private->full = 0;
+        pthread_cond_broadcast(&private->not_full);
+    }
+    pthread_mutex_unlock(&private->lock);
+    return n;
+}
+
+/**
+ *
+ * @param this
+ * @param d receives the element
+ * @param timeout as for dequeue_batch
+ * @return 0 on timeout or once closed and empty
+ */
+int _dequeue_blocking_queue(BlockingQueue *this, void** d, long timeout){
+    return _dequeue_batch_blocking_queue(this, d, 1, timeout) == 1;
+}
+
+/**
+ *
+ * @details Wakes every waiting thread: producers fail, consumers drain what
+ * is left and then get 0.
+ * @param this
+ */
+void _close_blocking_queue(BlockingQueue *this){
+    PrivateDataBlockingQueue *private = (PrivateDataBlockingQueue*)this->private;
+    pthread_mutex_lock(&private->lock);
+    private->closed = 1;
+    pthread_cond_broadcast(&private->not_empty);
+    pthread_cond_broadcast(&private->not_full);
+    pthread_mutex_unlock(&private->lock);
+}
+
+/**
+ *
+ * @param this
+ * @return
+ */
+unsigned int _get_size_blocking_queue(BlockingQueue *this){
+    PrivateDataBlockingQueue *private = (PrivateDataBlockingQueue*)this->private;
+    unsigned int size;
+    pthread_mutex_lock(&private->lock);
+    size = private->queue.get_size(&private->queue);
+    pthread_mutex_unlock(&private->lock);
+    return size;
+}
@@ -0,0 +1,56 @@
+#ifndef BLOCKING_QUEUE_H
+#define BLOCKING_QUEUE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include "queue.h"
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+#define BLOCKING_QUEUE_WAIT_FOREVER -1L
+
+typedef struct BlockingQueue BlockingQueue;
+
+/**
+ * Ring Queue behind a mutex. Producers block once size reaches high_water
+ * and stay blocked until consumers bring it down to low_water, so they
+ * wake in bursts instead of once per element. A consumer is woken when
+ * the queue stops being empty and drains up to max elements per wakeup.
+ */
+typedef struct PrivateDataBlockingQueue{
+    Queue queue;
+    pthread_mutex_t lock;
+    pthread_cond_t not_empty;
+    pthread_cond_t not_full;
+    unsigned int high_water;
+    unsigned int low_water;
+    int full;//high_water was reached and low_water not yet
+    int closed;
+}PrivateDataBlockingQueue;
+
+struct BlockingQueue{
+    void* const private;
+    unsigned int (*const get_size)(BlockingQueue *this);
+    int (*const enqueue)(BlockingQueue *this, const void* d);
+    int (*const try_enqueue)(BlockingQueue *this, const void* d);
+    int (*const dequeue)(BlockingQueue *this, void** d, long timeout);
+    unsigned int (*const dequeue_batch)(BlockingQueue *this, void** out, unsigned int max, long timeout);
+    void (*const close)(BlockingQueue *this);
+};
+
+BlockingQueue newBlockingQueue(unsigned int high_water, unsigned int low_water);
+void destroyBlockingQueue(BlockingQueue *this);
+static unsigned int _get_size_blocking_queue(BlockingQueue *this);
+static int _enqueue_blocking_queue(BlockingQueue *this, const void* d);
+static int _try_enqueue_blocking_queue(BlockingQueue *this, const void* d);
+static int _dequeue_blocking_queue(BlockingQueue *this, void** d, long timeout);
+static unsigned int _dequeue_batch_blocking_queue(BlockingQueue *this, void** out, unsigned int max, long timeout);
+static void _close_blocking_queue(BlockingQueue *this);
+
+#ifdef	__cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,78 @@
+/*
+ * File:   blocking_queue_main.c
+ * Author: regoeco
+ *
+ * Producers feed consumers through a BlockingQueue with a high water mark;
+ * consumers drain batches. Every number must be consumed exactly once.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include "blocking_queue.h"
+
+#define NUM_PRODUCERS 3
+#define NUM_CONSUMERS 2
+#ifndef NUM_ITEMS
+#define NUM_ITEMS 100000
+#endif
+#define HIGH_WATER 1024
+#define LOW_WATER 256
+#define BATCH 128
+
+BlockingQueue *queue;
+long numbers[NUM_PRODUCERS*NUM_ITEMS];
+atomic_int seen[NUM_PRODUCERS*NUM_ITEMS];
+atomic_long num_batches;
+
+void* producer(void* arg){
+    int t = (int)(long)arg;
+    int i;
+    for(i = 0; i < NUM_ITEMS; i++)
+        queue->enqueue(queue, &numbers[t*NUM_ITEMS + i]);
+    return NULL;
+}
+
+void* consumer(void* arg){
+    void* batch[BATCH];
+    unsigned int i, n;
+    while((n = queue->dequeue_batch(queue, batch, BATCH, BLOCKING_QUEUE_WAIT_FOREVER)) > 0){
+        for(i = 0; i < n; i++)
+            atomic_fetch_add(&seen[*(long*)batch[i]], 1);
+        atomic_fetch_add(&num_batches, 1);
+    }
+    return NULL;
+}
+
+//MAIN
+int main(int argc, char** argv)
+{
+    pthread_t producers[NUM_PRODUCERS], consumers[NUM_CONSUMERS];
+    int i, errors = 0;
+    void* d;
+
+    BlockingQueue q = newBlockingQueue(HIGH_WATER, LOW_WATER);
+    queue = &q;
+    for(i = 0; i < NUM_PRODUCERS*NUM_ITEMS; i++)
+        numbers[i] = i;
+
+    //TIMEOUT ON AN EMPTY QUEUE
+    printf("Dequeue on empty with 10 ms timeout:%d\n", queue->dequeue(queue, &d, 10));
+
+    for(i = 0; i < NUM_CONSUMERS; i++)
+        pthread_create(&consumers[i], NULL, consumer, NULL);
+    for(i = 0; i < NUM_PRODUCERS; i++)
+        pthread_create(&producers[i], NULL, producer, (void*)(long)i);
+    for(i = 0; i < NUM_PRODUCERS; i++)
+        pthread_join(producers[i], NULL);
+    queue->close(queue);
+    for(i = 0; i < NUM_CONSUMERS; i++)
+        pthread_join(consumers[i], NULL);
+
+    for(i = 0; i < NUM_PRODUCERS*NUM_ITEMS; i++)
+        if(atomic_load(&seen[i]) != 1)
+            errors++;
+    printf("Items:%d Batches:%ld Errors:%d\n", NUM_PRODUCERS*NUM_ITEMS, atomic_load(&num_batches), errors);
+
+    destroyBlockingQueue(&q);
+    return errors == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,104 @@
+/*
+ * File:   concurrent_main.c
+ * Author: regoeco
+ *
+ * Stress run of the SPSC and MPMC queues: producers enqueue their own
+ * numbers through a small queue, consumers dequeue them; every number must
+ * come out exactly once and, per producer, in order.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include "concurrent_queue.h"
+
+#define NUM_PRODUCERS 4
+#define NUM_CONSUMERS 4
+#ifndef NUM_ITEMS
+#define NUM_ITEMS 200000
+#endif
+#define CAPACITY 64
+
+ConcurrentQueue *queue;
+long numbers[NUM_PRODUCERS*NUM_ITEMS];
+atomic_int seen[NUM_PRODUCERS*NUM_ITEMS];
+atomic_int errors;
+int num_items_per_consumer;
+
+void* producer(void* arg){
+    int t = (int)(long)arg;
+    int i;
+    for(i = 0; i < NUM_ITEMS; i++){
+        if(i % 3 == 0){
+            while(!queue->try_enqueue(queue, &numbers[t*NUM_ITEMS + i]));
+        }else{
+            queue->enqueue(queue, &numbers[t*NUM_ITEMS + i]);
+        }
+    }
+    return NULL;
+}
+
+void* consumer(void* arg){
+    long last[NUM_PRODUCERS];
+    int i;
+    void* d;
+    for(i = 0; i < NUM_PRODUCERS; i++)
+        last[i] = -1;
+    for(i = 0; i < num_items_per_consumer; i++){
+        long n;
+        queue->dequeue(queue, &d);
+        n = *(long*)d;
+        if(n <= last[n/NUM_ITEMS])
+            atomic_fetch_add(&errors, 1);
+        last[n/NUM_ITEMS] = n;
+        atomic_fetch_add(&seen[n], 1);
+    }
+    return NULL;
+}
+
+/**
+ *
+ * @param q
+ * @param name
+ * @param num_producers
+ * @param num_consumers
+ * @return errors
+ */
+int run(ConcurrentQueue *q, const char* name, int num_producers, int num_consumers){
+    pthread_t threads[NUM_PRODUCERS + NUM_CONSUMERS];
+    int i, total = num_producers*NUM_ITEMS;
+    queue = q;
+    atomic_store(&errors, 0);
+    num_items_per_consumer = total/num_consumers;
+    for(i = 0; i < total; i++)
+        atomic_store(&seen[i], 0);
+    for(i = 0; i < num_consumers; i++)
+        pthread_create(&threads[i], NULL, consumer, NULL);
+    for(i = 0; i < num_producers; i++)
+        pthread_create(&threads[num_consumers + i], NULL, producer, (void*)(long)i);
+    for(i = 0; i < num_producers + num_consumers; i++)
+        pthread_join(threads[i], NULL);
+    for(i = 0; i < total; i++)
+        if(atomic_load(&seen[i]) != 1)
+            atomic_fetch_add(&errors, 1);
+    printf("%s Producers:%d Consumers:%d Items:%d Capacity:%u Size:%u Errors:%d\n", name, num_producers, num_consumers,
+           total, q->get_capacity(q), q->get_size(q), atomic_load(&errors));
+    return atomic_load(&errors);
+}
+
+//MAIN
+int main(int argc, char** argv)
+{
+    int i, r = 0;
+    for(i = 0; i < NUM_PRODUCERS*NUM_ITEMS; i++)
+        numbers[i] = i;
+
+    ConcurrentQueue spsc = newSpscQueue(CAPACITY);
+    r += run(&spsc, "SPSC", 1, 1);
+    destroySpscQueue(&spsc);
+
+    ConcurrentQueue mpmc = newMpmcQueue(CAPACITY);
+    r += run(&mpmc, "MPMC", NUM_PRODUCERS, NUM_CONSUMERS);
+    destroyMpmcQueue(&mpmc);
+
+    return r == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
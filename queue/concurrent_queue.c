@@ -0,0 +1,305 @@
+#include <sched.h>
+#include "concurrent_queue.h"
+
+#define SPIN_LIMIT 64
+
+/**
+ *
+ * @param capacity
+ * @return smallest power of two >= capacity, at least 2
+ */
+static unsigned long round_capacity(unsigned int capacity){
+    unsigned long c = 2;
+    while(c < capacity)
+        c <<= 1;
+    return c;
+}
+
+/**
+ *
+ * @details Spins a little, then gives the CPU away while waiting.
+ * @param spins
+ */
+static void backoff(unsigned int *spins){
+    if(*spins < SPIN_LIMIT)
+        (*spins)++;
+    else
+        sched_yield();
+}
+
+/**
+ *
+ * @param capacity
+ * @return ConcurrentQueue
+ */
+ConcurrentQueue newSpscQueue(unsigned int capacity){
+    PrivateDataSpscQueue* p = NULL;
+    if(posix_memalign((void**)&p, QUEUE_CACHE_LINE, sizeof(PrivateDataSpscQueue)) != 0)
+        p = NULL;
+    if(p != NULL){
+        p->mask = round_capacity(capacity) - 1;
+        p->slots = malloc((p->mask + 1)*sizeof(void*));
+        atomic_init(&p->head, 0);
+        atomic_init(&p->tail, 0);
+        p->cached_head = 0;
+        p->cached_tail = 0;
+    }
+    ConcurrentQueue q = {
+        .private = p,
+        .get_size = _get_size_spsc_queue,
+        .get_capacity = _get_capacity_spsc_queue,
+        .try_enqueue = _try_enqueue_spsc_queue,
+        .try_dequeue = _try_dequeue_spsc_queue,
+        .enqueue = _enqueue_spsc_queue,
+        .dequeue = _dequeue_spsc_queue
+    };
+    return q;
+}
+
+/**
+ *
+ * @param this
+ */
+void destroySpscQueue(ConcurrentQueue *this){
+    PrivateDataSpscQueue *private = (PrivateDataSpscQueue*)this->private;
+    if(private != NULL)
+        free(private->slots);
+    free(private);
+}
+
+/**
+ *
+ * @details Producer side only.
+ * @param this
+ * @param d
+ * @return 0 if full
+ */
+int _try_enqueue_spsc_queue(ConcurrentQueue *this, void* d){
+    PrivateDataSpscQueue *private = (PrivateDataSpscQueue*)this->private;
+    unsigned long tail = atomic_load_explicit(&private->tail, memory_order_relaxed);
+    if(tail - private->cached_head > private->mask){
+        private->cached_head = atomic_load_explicit(&private->head, memory_order_acquire);
+        if(tail - private->cached_head > private->mask)
+            return 0;
+    }
+    private->slots[tail & private->mask] = d;
+    atomic_store_explicit(&private->tail, tail + 1, memory_order_release);
+    return 1;
+}
+
+/**
+ *
+ * @details Consumer side only.
+ * @param this
+ * @param d receives the element
+ * @return 0 if empty
+ */
+int _try_dequeue_spsc_queue(ConcurrentQueue *this, void** d){
+    PrivateDataSpscQueue *private = (PrivateDataSpscQueue*)this->private;
+    unsigned long head = atomic_load_explicit(&private->head, memory_order_relaxed);
+    if(head == private->cached_tail){
+        private->cached_tail = atomic_load_explicit(&private->tail, memory_order_acquire);
+        if(head == private->cached_tail)
+            return 0;
+    }
+    *d = private->slots[head & private->mask];
+    atomic_store_explicit(&private->head, head + 1, memory_order_release);
+    return 1;
+}
+
+/**
+ *
+ * @details Waits while the queue is full.
+ * @param this
+ * @param d
+ */
+void _enqueue_spsc_queue(ConcurrentQueue *this, void* d){
+    unsigned int spins = 0;
+    while(!_try_enqueue_spsc_queue(this, d))
+        backoff(&spins);
+}
+
+/**
+ *
+ * @details Waits while the queue is empty.
+ * @param this
+ * @param d
+ */
+void _dequeue_spsc_queue(ConcurrentQueue *this, void** d){
+    unsigned int spins = 0;
+    while(!_try_dequeue_spsc_queue(this, d))
+        backoff(&spins);
+}
+
+/**
+ *
+ * @details Only a hint while the other side is running.
+ * @param this
+ * @return
+ */
+unsigned int _get_size_spsc_queue(ConcurrentQueue *this){
+    PrivateDataSpscQueue *private = (PrivateDataSpscQueue*)this->private;
+    unsigned long head = atomic_load_explicit(&private->head, memory_order_acquire);
+    unsigned long tail = atomic_load_explicit(&private->tail, memory_order_acquire);
+    return tail > head ? (unsigned int)(tail - head) : 0;
+}
+
+/**
+ *
+ * @param this
+ * @return
+ */
+unsigned int _get_capacity_spsc_queue(ConcurrentQueue *this){
+    PrivateDataSpscQueue *private = (PrivateDataSpscQueue*)this->private;
+    return (unsigned int)(private->mask + 1);
+}
+
+/**
+ *
+ * @param capacity
+ * @return ConcurrentQueue
+ */
+ConcurrentQueue newMpmcQueue(unsigned int capacity){
+    PrivateDataMpmcQueue* p = NULL;
+    if(posix_memalign((void**)&p, QUEUE_CACHE_LINE, sizeof(PrivateDataMpmcQueue)) != 0)
+        p = NULL;
+    if(p != NULL){
+        unsigned long i;
+        p->mask = round_capacity(capacity) - 1;
+        p->cells = malloc((p->mask + 1)*sizeof(MpmcCell));
+        for(i = 0; p->cells != NULL && i <= p->mask; i++)
+            atomic_init(&p->cells[i].sequence, i);
+        atomic_init(&p->head, 0);
+        atomic_init(&p->tail, 0);
+    }
+    ConcurrentQueue q = {
+        .private = p,
+        .get_size = _get_size_mpmc_queue,
+        .get_capacity = _get_capacity_mpmc_queue,
+        .try_enqueue = _try_enqueue_mpmc_queue,
+        .try_dequeue = _try_dequeue_mpmc_queue,
+        .enqueue = _enqueue_mpmc_queue,
+        .dequeue = _dequeue_mpmc_queue
+    };
+    return q;
+}
+
+/**
+ *
+ * @param this
+ */
+void destroyMpmcQueue(ConcurrentQueue *this){
+    PrivateDataMpmcQueue *private = (PrivateDataMpmcQueue*)this->private;
+    if(private != NULL)
+        free(private->cells);
+    free(private);
+}
+
+/**
+ *
+ * @details A producer claims a position with a CAS on tail only when the
+ * cell's sequence says it is free, then publishes by bumping the sequence.
+ * @param this
+ * @param d
+ * @return 0 if full
+ */
+int _try_enqueue_mpmc_queue(ConcurrentQueue *this, void* d){
+    PrivateDataMpmcQueue *private = (PrivateDataMpmcQueue*)this->private;
+    unsigned long position = atomic_load_explicit(&private->tail, memory_order_relaxed);
+    MpmcCell *cell;
+    for(;;){
+        cell = &private->cells[position & private->mask];
+        unsigned long sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        long diff = (long)sequence - (long)position;
+        if(diff == 0){
+            if(atomic_compare_exchange_weak_explicit(&private->tail, &position, position + 1,
+                                                     memory_order_relaxed, memory_order_relaxed))
+                break;
+        }else if(diff < 0){
+            return 0;
+        }else{
+            position = atomic_load_explicit(&private->tail, memory_order_relaxed);
+        }
+    }
+    cell->data = d;
+    atomic_store_explicit(&cell->sequence, position + 1, memory_order_release);
+    return 1;
+}
+
+/**
+ *
+ * @details A consumer claims a position whose cell holds an element and
+ * frees the cell for the producer one lap later.
+ * @param this
+ * @param d receives the element
+ * @return 0 if empty
+ */
+int _try_dequeue_mpmc_queue(ConcurrentQueue *this, void** d){
+    PrivateDataMpmcQueue *private = (PrivateDataMpmcQueue*)this->private;
+    unsigned long position = atomic_load_explicit(&private->head, memory_order_relaxed);
+    MpmcCell *cell;
+    for(;;){
+        cell = &private->cells[position & private->mask];
+        unsigned long sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        long diff = (long)sequence - (long)(position + 1);
+        if(diff == 0){
+            if(atomic_compare_exchange_weak_explicit(&private->head, &position, position + 1,
+                                                     memory_order_relaxed, memory_order_relaxed))
+                break;
+        }else if(diff < 0){
+            return 0;
+        }else{
+            position = atomic_load_explicit(&private->head, memory_order_relaxed);
+        }
+    }
+    *d = cell->data;
+    atomic_store_explicit(&cell->sequence, position + private->mask + 1, memory_order_release);
+    return 1;
+}
+
+/**
+ *
+ * @details Waits while the queue is full.
+ * @param this
+ * @param d
+ */
+void _enqueue_mpmc_queue(ConcurrentQueue *this, void* d){
+    unsigned int spins = 0;
+    while(!_try_enqueue_mpmc_queue(this, d))
+        backoff(&spins);
+}
+
+/**
+ *
+ * @details Waits while the queue is empty.
+ * @param this
+ * @param d
+ */
+void _dequeue_mpmc_queue(ConcurrentQueue *this, void** d){
+    unsigned int spins = 0;
+    while(!_try_dequeue_mpmc_queue(this, d))
+        backoff(&spins);
+}
+
+/**
+ *
+ * @details Only a hint while other threads are running.
+ * @param this
+ * @return
+ */
+unsigned int _get_size_mpmc_queue(ConcurrentQueue *this){
+    PrivateDataMpmcQueue *private = (PrivateDataMpmcQueue*)this->private;
+    unsigned long head = atomic_load_explicit(&private->head, memory_order_acquire);
+    unsigned long tail = atomic_load_explicit(&private->tail, memory_order_acquire);
+    return tail > head ? (unsigned int)(tail - head) : 0;
+}
+
+/**
+ *
+ * @param this
+ * @return
+ */
+unsigned int _get_capacity_mpmc_queue(ConcurrentQueue *this){
+    PrivateDataMpmcQueue *private = (PrivateDataMpmcQueue*)this->private;
+    return (unsigned int)(private->mask + 1);
+}
@@ -0,0 +1,81 @@
+#ifndef CONCURRENT_QUEUE_H
+#define CONCURRENT_QUEUE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+/**
+ * Bounded lock-free queues to hand work between threads. The capacity is
+ * rounded up to a power of two. Producer and consumer indices sit on their
+ * own cache line so the two sides do not invalidate each other's line.
+ */
+#define QUEUE_CACHE_LINE 64
+
+typedef struct ConcurrentQueue ConcurrentQueue;
+
+/**
+ * Single producer, single consumer: each side owns its index and only
+ * reads the other's, with a cached copy to touch the shared line less.
+ */
+typedef struct PrivateDataSpscQueue{
+    _Alignas(QUEUE_CACHE_LINE) atomic_ulong head;//next slot to read, written by the consumer
+    unsigned long cached_tail;
+    _Alignas(QUEUE_CACHE_LINE) atomic_ulong tail;//next slot to write, written by the producer
+    unsigned long cached_head;
+    _Alignas(QUEUE_CACHE_LINE) unsigned long mask;
+    void** slots;
+}PrivateDataSpscQueue;
+
+/**
+ * Slot of a multi producer, multi consumer queue (D. Vyukov). sequence is
+ * position when the slot is free for the producer of that position and
+ * position + 1 when it holds the element for the consumer.
+ */
+typedef struct MpmcCell{
+    atomic_ulong sequence;
+    void* data;
+}MpmcCell;
+
+typedef struct PrivateDataMpmcQueue{
+    _Alignas(QUEUE_CACHE_LINE) atomic_ulong head;//next position to dequeue
+    _Alignas(QUEUE_CACHE_LINE) atomic_ulong tail;//next position to enqueue
+    _Alignas(QUEUE_CACHE_LINE) unsigned long mask;
+    MpmcCell* cells;
+}PrivateDataMpmcQueue;
+
+struct ConcurrentQueue{
+    void* const private;
+    unsigned int (*const get_size)(ConcurrentQueue *this);
+    unsigned int (*const get_capacity)(ConcurrentQueue *this);
+    int (*const try_enqueue)(ConcurrentQueue *this, void* d);
+    int (*const try_dequeue)(ConcurrentQueue *this, void** d);
+    void (*const enqueue)(ConcurrentQueue *this, void* d);
+    void (*const dequeue)(ConcurrentQueue *this, void** d);
+};
+
+ConcurrentQueue newSpscQueue(unsigned int capacity);
+ConcurrentQueue newMpmcQueue(unsigned int capacity);
+void destroySpscQueue(ConcurrentQueue *this);
+void destroyMpmcQueue(ConcurrentQueue *this);
+static unsigned int _get_size_spsc_queue(ConcurrentQueue *this);
+static unsigned int _get_capacity_spsc_queue(ConcurrentQueue *this);
+static int _try_enqueue_spsc_queue(ConcurrentQueue *this, void* d);
+static int _try_dequeue_spsc_queue(ConcurrentQueue *this, void** d);
+static void _enqueue_spsc_queue(ConcurrentQueue *this, void* d);
+static void _dequeue_spsc_queue(ConcurrentQueue *this, void** d);
+static unsigned int _get_size_mpmc_queue(ConcurrentQueue *this);
+static unsigned int _get_capacity_mpmc_queue(ConcurrentQueue *this);
+static int _try_enqueue_mpmc_queue(ConcurrentQueue *this, void* d);
+static int _try_dequeue_mpmc_queue(ConcurrentQueue *this, void** d);
+static void _enqueue_mpmc_queue(ConcurrentQueue *this, void* d);
+static void _dequeue_mpmc_queue(ConcurrentQueue *this, void** d);
+
+#ifdef	__cplusplus
+}
+#endif
+#endif
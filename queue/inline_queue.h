@@ -0,0 +1,40 @@
+#ifndef INLINE_QUEUE_H
+#define INLINE_QUEUE_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+/**
+ * Storage of a ring queue, the part of queue.h a caller needs to enqueue
+ * and dequeue inline values without going through the Queue methods (see
+ * queue.hpp). Names nothing that is a C++ keyword, queue.h includes it.
+ */
+#define QUEUE_RING_CAPACITY 64
+
+typedef struct Queue Queue;
+
+/**
+ * Circular buffer, the capacity is a power of two so the slot of the i-th
+ * element is (head + i) & (capacity - 1). A full buffer doubles. A slot
+ * holds a void* or, for an inline queue, the value itself.
+ */
+typedef struct PrivateDataRingQueue{
+    unsigned char* slots;
+    unsigned int capacity;
+    unsigned int element_size;
+    int by_value;//slots hold copies of the values instead of pointers
+    unsigned int head;//slot of the first element
+    unsigned int size;
+}PrivateDataRingQueue;
+
+Queue* newInlineQueuePtr(unsigned int element_size, unsigned int capacity);
+void destroyQueuePtr(Queue *queue);
+void clearQueue(Queue *queue);
+struct PrivateDataRingQueue* getPrivateDataRingQueue(Queue *queue);
+int growRingQueue(struct PrivateDataRingQueue *data, unsigned int min_capacity);
+
+#ifdef	__cplusplus
+}
+#endif
+#endif
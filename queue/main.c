@@ -3,6 +3,9 @@
 #include "queue.h"
 int main(int, char**);
 
+#define CHURN_ROUNDS 32
+#define CHURN_ITEMS 1000
+
 //INTERFACE OF CALLBACKS
 const void callback_enqueue(const void*);
 const void callback_dequeue(const void*);
@@ -13,6 +16,38 @@ typedef struct {
     int number;
 } struct_number;
 
+/**
+ *
+ * @details Enqueues and dequeues CHURN_ITEMS numbers a round through a
+ * pooled queue; dequeued nodes must be reused, never carved again.
+ * @param pool
+ * @return number of mismatches
+ */
+int churn_pooled(NodePool *pool){
+    static struct_number n[CHURN_ITEMS];
+    unsigned int slabs = 0;
+    int round, i, errors = 0;
+    for(round = 0; round < CHURN_ROUNDS; round++){
+        Queue queue = newPooledQueue(pool);
+        for(i = 0; i < CHURN_ITEMS; i++){
+            n[i].number = i;
+            queue.enqueue(&queue, &n[i], NULL);
+        }
+        for(i = 0; i < CHURN_ITEMS; i++){
+            struct_number *s = (struct_number*)queue.peek(&queue);
+            if(s == NULL || s->number != i)
+                errors++;
+            queue.dequeue(&queue, NULL);
+        }
+        destroyQueue(&queue);
+        if(round == 0)
+            slabs = pool->get_num_slabs(pool);
+    }
+    if(pool->get_num_slabs(pool) != slabs)
+        errors++;
+    return errors;
+}
+
 //MAIN
 int main(int argc, char** argv)
 {
@@ -41,7 +76,13 @@ int main(int argc, char** argv)
     
     //DESTROY QUEUE
     destroyQueue(&queue);
-    return (EXIT_SUCCESS);
+
+    //POOLED CHURN
+    NodePool pool = newNodePool(sizeof(ELEMENT_QUEUE), 0);
+    int errors = churn_pooled(&pool);
+    printf("\nSlabs:%u Errors:%d\n", pool.get_num_slabs(&pool), errors);
+    destroyNodePool(&pool);
+    return errors == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
 }
 
 const void callback_enqueue(const void* new_data) {
@@ -0,0 +1,300 @@
+#include "priority_queue.h"
+
+/**
+ *
+ * @param arity children per node, 0 for PRIORITY_QUEUE_ARITY
+ * @param callback_order
+ * @return PriorityQueue
+ */
+PriorityQueue newPriorityQueue(unsigned int arity, int(*const callback_order)(const void* new, const void* inserted)){
+    PrivateDataPriorityQueue* p = malloc(sizeof(PrivateDataPriorityQueue));
+    p->heap = NULL;
+    p->size = 0;
+    p->capacity = 0;
+    p->arity = arity >= 2 ? arity : PRIORITY_QUEUE_ARITY;
+    p->position = NULL;
+    p->num_handles = 0;
+    p->free_handles = NULL;
+    p->num_free_handles = 0;
+    p->callback_order = callback_order;
+    PriorityQueue q = {
+        .private = p,
+        .get_size = _get_size_priority_queue,
+        .push = _push_priority_queue,
+        .pop = _pop_priority_queue,
+        .peek = _peek_priority_queue,
+        .decrease_key = _decrease_key_priority_queue,
+        .heapify = _heapify_priority_queue,
+        .empty = _empty_priority_queue,
+        .print = _print_priority_queue
+    };
+    return q;
+}
+
+/**
+ *
+ * @param this
+ */
+void destroyPriorityQueue(PriorityQueue *this){
+    PrivateDataPriorityQueue *private = (PrivateDataPriorityQueue*)this->private;
+    free(private->heap);
+    free(private->position);
+    free(private->free_handles);
+    free(private);
+}
+
+/**
+ *
+ * @details Grows the heap and the handle tables so size + n elements fit.
+ * Every element can hold a handle, so the handle tables never need more
+ * slots than the heap once freed handles are given out again.
+ * @param private
+ * @param n
+ * @return
+ */
+static int reserve(PrivateDataPriorityQueue *private, unsigned int n){
+    unsigned int capacity = private->capacity > 0 ? private->capacity : PRIORITY_QUEUE_CAPACITY;
+    if(n > 0x80000000u - private->size)
+        return 0;
+    if(private->size + n <= private->capacity)
+        return 1;
+    while(capacity < private->size + n)
+        capacity <<= 1;
+    PriorityQueueEntry* heap = realloc(private->heap, capacity*sizeof(PriorityQueueEntry));
+    if(heap == NULL)
+        return 0;
+    private->heap = heap;
+    unsigned int* position = realloc(private->position, capacity*sizeof(unsigned int));
+    if(position == NULL)
+        return 0;
+    private->position = position;
+    unsigned int* free_handles = realloc(private->free_handles, capacity*sizeof(unsigned int));
+    if(free_handles == NULL)
+        return 0;
+    private->free_handles = free_handles;
+    private->capacity = capacity;
+    return 1;
+}
+
+/**
+ *
+ * @param private
+ * @return a free handle, room must be reserved
+ */
+static PriorityQueueHandle new_handle(PrivateDataPriorityQueue *private){
+    if(private->num_free_handles > 0)
+        return private->free_handles[--private->num_free_handles];
+    return private->num_handles++;
+}
+
+/**
+ *
+ * @param private
+ * @param i slot
+ * @param entry
+ */
+static void place(PrivateDataPriorityQueue *private, unsigned int i, PriorityQueueEntry entry){
+    private->heap[i] = entry;
+    private->position[entry.handle] = i;
+}
+
+/**
+ *
+ * @details Moves the entry of slot i up while it goes before its parent.
+ * @param private
+ * @param i
+ */
+static void sift_up(PrivateDataPriorityQueue *private, unsigned int i){
+    PriorityQueueEntry entry = private->heap[i];
+    while(i > 0){
+        unsigned int parent = (i - 1)/private->arity;
+        if(private->callback_order(entry.data, private->heap[parent].data) >= 0)
+            break;
+        place(private, i, private->heap[parent]);
+        i = parent;
+    }
+    place(private, i, entry);
+}
+
+/**
+ *
+ * @details Moves the entry of slot i down while a child goes before it.
+ * @param private
+ * @param i
+ */
+static void sift_down(PrivateDataPriorityQueue *private, unsigned int i){
+    PriorityQueueEntry entry = private->heap[i];
+    for(;;){
+        unsigned int first = private->arity*i + 1, last, child, best;
+        if(first >= private->size || first < i)
+            break;
+        last = first + private->arity;
+        if(last > private->size)
+            last = private->size;
+        best = first;
+        for(child = first + 1; child < last; child++){
+            if(private->callback_order(private->heap[child].data, private->heap[best].data) < 0)
+                best = child;
+        }
+        if(private->callback_order(private->heap[best].data, entry.data) >= 0)
+            break;
+        place(private, i, private->heap[best]);
+        i = best;
+    }
+    place(private, i, entry);
+}
+
+/**
+ *
+ * @param this
+ * @param d
+ * @param handle receives the handle of d for decrease_key, may be NULL
+ * @return
+ */
+int _push_priority_queue(PriorityQueue *this, const void* d, PriorityQueueHandle* handle){
+    PrivateDataPriorityQueue *private = (PrivateDataPriorityQueue*)this->private;
+    PriorityQueueEntry entry;
+    if(!reserve(private, 1))
+        return 0;
+    entry.data = (void*)d;
+    entry.handle = new_handle(private);
+    if(handle != NULL)
+        *handle = entry.handle;
+    private->heap[private->size] = entry;
+    sift_up(private, private->size++);
+    return 1;
+}
+
+/**
+ *
+ * @details Removes the first element, its handle becomes invalid.
+ * @param this
+ * @param callback
+ * @return
+ */
+int _pop_priority_queue(PriorityQueue *this, void(*const callback)(const void*)){
+    PrivateDataPriorityQueue *private = (PrivateDataPriorityQueue*)this->private;
+    if(private->size > 0){
+        PriorityQueueEntry first = private->heap[0];
+        private->position[first.handle] = PRIORITY_QUEUE_NO_HANDLE;
+        private->free_handles[private->num_free_handles++] = first.handle;
+        if(--private->size > 0){
+            private->heap[0] = private->heap[private->size];
+            sift_down(private, 0);
+        }
+        //CODE HERE
+        if(callback != NULL)
+            callback(first.data);
+        //END
+        return 1;
+    }else return 0;
+}
+
+/**
+ *
+ * @param this
+ * @return
+ */
+void* _peek_priority_queue(PriorityQueue *this){
+    PrivateDataPriorityQueue *private = (PrivateDataPriorityQueue*)this->private;
+    if(private->size > 0){
+        return private->heap[0].data;
+    }else{
+        return NULL;
+    }
+}
+
+/**
+ *
+ * @details d replaces the element of handle (it can be the same pointer,
+ * changed by the caller) and must not go after it.
+ * @param this
+ * @param handle
+ * @param d
+ * @return 0 if the handle is not in the queue
+ */
+int _decrease_key_priority_queue(PriorityQueue *this, PriorityQueueHandle handle, const void* d){
+    PrivateDataPriorityQueue *private = (PrivateDataPriorityQueue*)this->private;
+    unsigned int i;
+    if(handle >= private->num_handles || private->position[handle] == PRIORITY_QUEUE_NO_HANDLE)
+        return 0;
+    i = private->position[handle];
+    private->heap[i].data = (void*)d;
+    sift_up(private, i);
+    return 1;
+}
+
+/**
+ *
+ * @details Appends the elements and restores the heap bottom-up (Floyd),
+ * O(size + n) instead of n pushes.
+ * @param this
+ * @param items n consecutive void*
+ * @param n
+ * @param handles receives the n handles, may be NULL
+ * @return elements added
+ */
+unsigned int _heapify_priority_queue(PriorityQueue *this, const void* items, unsigned int n, PriorityQueueHandle* handles){
+    PrivateDataPriorityQueue *private = (PrivateDataPriorityQueue*)this->private;
+    void* const* d = (void* const*)items;
+    unsigned int i;
+    if(n == 0 || !reserve(private, n))
+        return 0;
+    for(i = 0; i < n; i++){
+        PriorityQueueEntry entry;
+        entry.data = d[i];
+        entry.handle = new_handle(private);
+        if(handles != NULL)
+            handles[i] = entry.handle;
+        place(private, private->size + i, entry);
+    }
+    private->size += n;
+    for(i = private->size/private->arity + 1; i-- > 0;)
+        sift_down(private, i);
+    return n;
+}
+
+/**
+ *
+ * @details Keeps the arrays, every handle becomes invalid.
+ * @param this
+ * @return
+ */
+int _empty_priority_queue(PriorityQueue *this){
+    PrivateDataPriorityQueue *private = (PrivateDataPriorityQueue*)this->private;
+    int r = private->size > 0;
+    private->size = 0;
+    private->num_handles = 0;
+    private->num_free_handles = 0;
+    return r;
+}
+
+/**
+ *
+ * @details In heap order, not sorted.
+ * @param this
+ * @param callback
+ */
+void _print_priority_queue(PriorityQueue *this, void(*const callback)(const void*)){
+    PrivateDataPriorityQueue *private = (PrivateDataPriorityQueue*)this->private;
+    if(private->size > 0){
+        unsigned int i;
+        for(i = 0; i < private->size; i++){
+            if(callback != NULL)
+                callback(private->heap[i].data);
+        }
+        printf(" NULL.\n");
+    }else{
+        printf("\nCola vacia.\n");
+    }
+}
+
+/**
+ *
+ * @param this
+ * @return
+ */
+unsigned int _get_size_priority_queue(PriorityQueue *this){
+    PrivateDataPriorityQueue *private = (PrivateDataPriorityQueue*)this->private;
+    return private->size;
+}
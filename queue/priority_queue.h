@@ -0,0 +1,69 @@
+#ifndef PRIORITY_QUEUE_H
+#define PRIORITY_QUEUE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+#define PRIORITY_QUEUE_ARITY 4
+#define PRIORITY_QUEUE_CAPACITY 64
+#define PRIORITY_QUEUE_NO_HANDLE 0xFFFFFFFFu
+
+typedef unsigned int PriorityQueueHandle;
+typedef struct PriorityQueue PriorityQueue;
+
+/**
+ * Slot of the heap array, the handle finds the slot back through position.
+ */
+typedef struct PriorityQueueEntry{
+    void* data;
+    PriorityQueueHandle handle;
+}PriorityQueueEntry;
+
+/**
+ * Array-backed d-ary min heap: the children of slot i are d*i+1..d*i+d.
+ * callback_order(a, b) returns -1 when a goes before b, as for BinaryTree.
+ */
+typedef struct PrivateDataPriorityQueue{
+    PriorityQueueEntry* heap;
+    unsigned int size;
+    unsigned int capacity;
+    unsigned int arity;
+    unsigned int* position;//handle -> slot, PRIORITY_QUEUE_NO_HANDLE when free
+    unsigned int num_handles;//handles ever given out
+    unsigned int* free_handles;//stack of handles to give out again
+    unsigned int num_free_handles;
+    int(*callback_order)(const void* new, const void* inserted);
+}PrivateDataPriorityQueue;
+
+struct PriorityQueue{
+    void* const private;
+    unsigned int (*const get_size)(PriorityQueue *this);
+    int (*const push)(PriorityQueue *this, const void* d, PriorityQueueHandle* handle);
+    int (*const pop)(PriorityQueue *this, void(*const callback)(const void*));
+    void* (*const peek)(PriorityQueue *this);
+    int (*const decrease_key)(PriorityQueue *this, PriorityQueueHandle handle, const void* d);
+    unsigned int (*const heapify)(PriorityQueue *this, const void* items, unsigned int n, PriorityQueueHandle* handles);
+    int (*const empty)(PriorityQueue *this);
+    void (*const print)(PriorityQueue *this, void(*const callback)(const void*));
+};
+
+PriorityQueue newPriorityQueue(unsigned int arity, int(*const callback_order)(const void* new, const void* inserted));
+void destroyPriorityQueue(PriorityQueue *this);
+static unsigned int _get_size_priority_queue(PriorityQueue *this);
+static int _push_priority_queue(PriorityQueue *this, const void* d, PriorityQueueHandle* handle);
+static int _pop_priority_queue(PriorityQueue *this, void(*const callback)(const void*));
+static void* _peek_priority_queue(PriorityQueue *this);
+static int _decrease_key_priority_queue(PriorityQueue *this, PriorityQueueHandle handle, const void* d);
+static unsigned int _heapify_priority_queue(PriorityQueue *this, const void* items, unsigned int n, PriorityQueueHandle* handles);
+static int _empty_priority_queue(PriorityQueue *this);
+static void _print_priority_queue(PriorityQueue *this, void(*const callback)(const void*));
+
+#ifdef	__cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,86 @@
+/*
+ * File:   priority_queue_main.c
+ * Author: regoeco
+ *
+ * Dijkstra over a small weighted graph with a PriorityQueue, updating
+ * tentative distances with decrease_key. Exits with failure if a distance
+ * is not the shortest one.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include "priority_queue.h"
+
+#define NUM_NODES 6
+#define INFINITE 1000000
+
+//INTERFACE OF CALLBACKS
+int callback_order(const void* new, const void* inserted);
+
+typedef struct {
+    int node;
+    int distance;
+} struct_distance;
+
+int weights[NUM_NODES][NUM_NODES] = {
+    {0, 7, 9, 0, 0, 14},
+    {7, 0, 10, 15, 0, 0},
+    {9, 10, 0, 11, 0, 2},
+    {0, 15, 11, 0, 6, 0},
+    {0, 0, 0, 6, 0, 9},
+    {14, 0, 2, 0, 9, 0}
+};
+
+int shortest[NUM_NODES] = {0, 7, 9, 20, 20, 11};
+
+//MAIN
+int main(int argc, char** argv)
+{
+    struct_distance distances[NUM_NODES];
+    void* items[NUM_NODES];
+    PriorityQueueHandle handles[NUM_NODES];
+    int done[NUM_NODES];
+    int i, errors = 0;
+
+    //INSTANCE
+    PriorityQueue queue = newPriorityQueue(PRIORITY_QUEUE_ARITY, callback_order);
+
+    //HEAPIFY EVERY NODE
+    for(i = 0; i < NUM_NODES; i++){
+        distances[i].node = i;
+        distances[i].distance = i == 0 ? 0 : INFINITE;
+        items[i] = &distances[i];
+        done[i] = 0;
+    }
+    queue.heapify(&queue, items, NUM_NODES, handles);
+
+    //POP THE CLOSEST, RELAX ITS EDGES
+    while(queue.get_size(&queue) > 0){
+        struct_distance *s = (struct_distance*)queue.peek(&queue);
+        queue.pop(&queue, NULL);
+        done[s->node] = 1;
+        for(i = 0; i < NUM_NODES; i++){
+            if(weights[s->node][i] > 0 && !done[i] && s->distance + weights[s->node][i] < distances[i].distance){
+                distances[i].distance = s->distance + weights[s->node][i];
+                queue.decrease_key(&queue, handles[i], &distances[i]);
+            }
+        }
+    }
+
+    for(i = 0; i < NUM_NODES; i++){
+        printf("Node:%d Distance:%d\n", i, distances[i].distance);
+        if(distances[i].distance != shortest[i])
+            errors++;
+    }
+    printf("Errors:%d\n", errors);
+
+    //DESTROY QUEUE
+    destroyPriorityQueue(&queue);
+    return errors == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int callback_order(const void* new, const void* inserted){
+    const struct_distance *a = new, *b = inserted;
+    if(a->distance < b->distance)
+        return -1;
+    return a->distance > b->distance ? 1 : 0;
+}
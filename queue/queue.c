@@ -5,10 +5,22 @@
  * @return Queue
  */
 Queue newQueue(){
+    return newPooledQueue(NULL);
+}
+
+/**
+ *
+ * @details Nodes come from pool, which must outlive the queue. A pool with
+ * nodes smaller than a QueueADT is ignored.
+ * @param pool NULL for malloc
+ * @return Queue
+ */
+Queue newPooledQueue(NodePool *pool){
     struct PrivateDataQueue* p = malloc(sizeof(struct PrivateDataQueue));
     p->size = 0;
     p->final = NULL;
     p->queue_adt = NULL;
+    p->pool = acceptNodePool(pool, sizeof(ELEMENT_QUEUE));
     Queue q = {
         .private = p,
         .enqueue = _enqueue_queue,
@@ -17,7 +29,109 @@ Queue newQueue(){
         .empty = _empty_queue,
         .print = _print_queue,
         .enqueue_multiple = _enqueue_multiple_queue,
-        .get_size = _get_size
+        .enqueue_n = _enqueue_n_queue,
+        .dequeue_n = _dequeue_n_queue,
+        .get_size = _get_size_queue
+    };
+    return q;
+}
+
+/**
+ *
+ * @details Elements are kept in a circular buffer that doubles when full,
+ * enqueue and dequeue do not allocate once it is big enough.
+ * @param capacity initial slots, rounded up to a power of two, 0 for QUEUE_RING_CAPACITY
+ * @return Queue
+ */
+Queue newRingQueue(unsigned int capacity){
+    return newRingQueueOf(capacity, sizeof(void*), 0);
+}
+
+/**
+ *
+ * @details Values of element_size bytes are copied into the buffer, enqueue
+ * takes the address of the value and dequeue_n copies values out, so small
+ * payloads need no allocation of their own.
+ * @param element_size
+ * @param capacity initial slots, rounded up to a power of two, 0 for QUEUE_RING_CAPACITY
+ * @return Queue
+ */
+Queue newInlineQueue(unsigned int element_size, unsigned int capacity){
+    return newRingQueueOf(capacity, element_size > 0 ? element_size : 1, 1);
+}
+
+/**
+ *
+ * @details Heap allocated newInlineQueue, for callers that only see
+ * inline_queue.h.
+ * @param element_size
+ * @param capacity initial slots, rounded up to a power of two, 0 for QUEUE_RING_CAPACITY
+ * @return
+ */
+Queue* newInlineQueuePtr(unsigned int element_size, unsigned int capacity){
+    Queue *queue = malloc(sizeof(Queue));
+    Queue q = newInlineQueue(element_size, capacity);
+    memcpy(queue, &q, sizeof(Queue));
+    return queue;
+}
+
+/**
+ *
+ * @param queue from newInlineQueuePtr
+ */
+void destroyQueuePtr(Queue *queue){
+    destroyQueue(queue);
+    free(queue);
+}
+
+/**
+ *
+ * @param queue
+ */
+void clearQueue(Queue *queue){
+    queue->empty(queue);
+}
+
+/**
+ *
+ * @param queue ring or inline
+ * @return
+ */
+struct PrivateDataRingQueue* getPrivateDataRingQueue(Queue *queue){
+    return (struct PrivateDataRingQueue*)queue->private;
+}
+
+/**
+ *
+ * @param capacity
+ * @param element_size
+ * @param by_value
+ * @return Queue
+ */
+static Queue newRingQueueOf(unsigned int capacity, unsigned int element_size, int by_value){
+    struct PrivateDataRingQueue* p = malloc(sizeof(struct PrivateDataRingQueue));
+    unsigned int c = 1;
+    if(capacity == 0)
+        capacity = QUEUE_RING_CAPACITY;
+    while(c < capacity && c < 0x80000000u)
+        c <<= 1;
+    p->slots = NULL;
+    p->capacity = c;
+    p->element_size = element_size;
+    p->by_value = by_value;
+    p->head = 0;
+    p->size = 0;
+    Queue q = {
+        .private = p,
+        .enqueue = _enqueue_ring_queue,
+        .dequeue = _dequeue_ring_queue,
+        .peek = _peek_ring_queue,
+        .empty = _empty_ring_queue,
+        .print = _print_ring_queue,
+        .enqueue_multiple = _enqueue_multiple_queue,
+        .enqueue_n = _enqueue_n_ring_queue,
+        .dequeue_n = _dequeue_n_ring_queue,
+        .get_size = _get_size_ring_queue
     };
     return q;
 }
@@ -42,7 +156,7 @@ int _enqueue_queue(Queue *this, const void* d, void(*const callback)(const void*
     QueueADT new;
     struct PrivateDataQueue *private = (struct PrivateDataQueue*)this->private;
 
-    new = (QueueADT)malloc(sizeof(ELEMENT_QUEUE));
+    new = (QueueADT)allocNode(private->pool, sizeof(ELEMENT_QUEUE));
     if(new != NULL){
         //CODE HERE
         if(callback != NULL)
@@ -77,7 +191,7 @@ int _dequeue_queue(Queue *this, void(*const callback)(const void*)) {
         if(callback != NULL)
             callback(p->data);
         //END
-        free(p);
+        releaseNode(private->pool, p);
         private->size--;
         return 1;
     }else return 0;
@@ -160,12 +274,278 @@ int _enqueue_multiple_queue(Queue *this, void(*const callback)(const void*), int
     return r;
 }
 
+/**
+ *
+ * @param this
+ * @param items n consecutive void*, items[0] is enqueued first
+ * @param n
+ * @return elements enqueued
+ */
+unsigned int _enqueue_n_queue(Queue *this, const void* items, unsigned int n){
+    struct PrivateDataQueue *private = (struct PrivateDataQueue*)this->private;
+    void* const* d = (void* const*)items;
+    unsigned int i;
+    for(i = 0; i < n; i++){
+        QueueADT new = (QueueADT)allocNode(private->pool, sizeof(ELEMENT_QUEUE));
+        if(new == NULL)
+            break;
+        new->data = d[i];
+        new->next = NULL;
+        if(private->queue_adt == NULL)
+            private->queue_adt = new;
+        else
+            private->final->next = new;
+        private->final = new;
+    }
+    private->size += i;
+    return i;
+}
+
+/**
+ *
+ * @param this
+ * @param out room for n void*, out[0] receives the front
+ * @param n
+ * @return elements dequeued
+ */
+unsigned int _dequeue_n_queue(Queue *this, void* out, unsigned int n){
+    struct PrivateDataQueue *private = (struct PrivateDataQueue*)this->private;
+    void** d = (void**)out;
+    unsigned int i;
+    for(i = 0; i < n && private->size > 0; i++){
+        QueueADT p = private->queue_adt;
+        d[i] = p->data;
+        private->queue_adt = p->next;
+        releaseNode(private->pool, p);
+        private->size--;
+    }
+    return i;
+}
+
 /**
  *
  * @param this
  * @return
  */
-unsigned int _get_size(Queue *this){
+unsigned int _get_size_queue(Queue *this){
     struct PrivateDataQueue *private = (struct PrivateDataQueue*)this->private;
     return private->size;
-}
\ No newline at end of file
+}
+/**
+ *
+ * @param private
+ * @param i slot index
+ * @return address of the slot
+ */
+static unsigned char* ring_slot(struct PrivateDataRingQueue *private, unsigned int i){
+    return private->slots + (size_t)i*private->element_size;
+}
+
+/**
+ *
+ * @param private
+ * @param slot
+ * @return what callbacks and peek see: the stored pointer or the address of the value
+ */
+static void* ring_data(struct PrivateDataRingQueue *private, unsigned char* slot){
+    return private->by_value ? (void*)slot : *(void**)slot;
+}
+
+/**
+ *
+ * @details Copies n elements between a buffer and the ring starting at slot
+ * first, in at most two runs.
+ * @param private
+ * @param first
+ * @param buffer
+ * @param n
+ * @param into_ring
+ */
+static void copy_ring(struct PrivateDataRingQueue *private, unsigned int first, unsigned char* buffer, unsigned int n, int into_ring){
+    size_t element_size = private->element_size;
+    unsigned int run = private->capacity - first;
+    if(run > n)
+        run = n;
+    if(into_ring){
+        memcpy(ring_slot(private, first), buffer, run*element_size);
+        memcpy(private->slots, buffer + run*element_size, (n - run)*element_size);
+    }else{
+        memcpy(buffer, ring_slot(private, first), run*element_size);
+        memcpy(buffer + run*element_size, private->slots, (n - run)*element_size);
+    }
+}
+
+/**
+ *
+ * @details Unrolls the elements at the start of a buffer that is doubled
+ * until it has room for min_capacity.
+ * @param private
+ * @param min_capacity
+ * @return
+ */
+int growRingQueue(struct PrivateDataRingQueue *private, unsigned int min_capacity){
+    unsigned int capacity = private->capacity;
+    unsigned char* slots;
+    if(private->slots != NULL && capacity >= min_capacity)
+        return 1;
+    while(capacity < min_capacity && capacity < 0x80000000u)
+        capacity <<= 1;
+    if(capacity < min_capacity)
+        return 0;
+    slots = malloc((size_t)capacity*private->element_size);
+    if(slots == NULL)
+        return 0;
+    if(private->slots != NULL){
+        copy_ring(private, private->head, slots, private->size, 0);
+        free(private->slots);
+    }
+    private->slots = slots;
+    private->capacity = capacity;
+    private->head = 0;
+    return 1;
+}
+
+/**
+ *
+ * @param this
+ * @param d the element, or the address of the value to copy for an inline queue
+ * @param callback
+ * @return
+ */
+int _enqueue_ring_queue(Queue *this, const void* d, void(*const callback)(const void*)) {
+    struct PrivateDataRingQueue *private = (struct PrivateDataRingQueue*)this->private;
+    unsigned int tail;
+    if(private->slots == NULL || private->size == private->capacity){
+        if(!growRingQueue(private, private->size + 1))
+            return 0;
+    }
+    //CODE HERE
+    if(callback != NULL)
+        callback(d);
+    //END
+    tail = (private->head + private->size) & (private->capacity - 1);
+    if(private->by_value)
+        memcpy(ring_slot(private, tail), d, private->element_size);
+    else
+        ((void**)private->slots)[tail] = (void*)d;
+    private->size++;
+    return 1;
+}
+
+/**
+ *
+ * @details For an inline queue the callback gets the address of the value,
+ * valid only during the call.
+ * @param this
+ * @param callback
+ * @return
+ */
+int _dequeue_ring_queue(Queue *this, void(*const callback)(const void*)) {
+    struct PrivateDataRingQueue *private = (struct PrivateDataRingQueue*)this->private;
+    if(private->size > 0){
+        void* d = ring_data(private, ring_slot(private, private->head));
+        private->head = (private->head + 1) & (private->capacity - 1);
+        private->size--;
+        //CODE HERE
+        if(callback != NULL)
+            callback(d);
+        //END
+        return 1;
+    }else return 0;
+}
+
+/**
+ *
+ * @details For an inline queue, the address of the value until the next change.
+ * @param this
+ * @return
+ */
+void* _peek_ring_queue(Queue *this) {
+    struct PrivateDataRingQueue *private = (struct PrivateDataRingQueue*)this->private;
+    if(private->size > 0){
+        return ring_data(private, ring_slot(private, private->head));
+    }else {
+        return NULL;
+    }
+}
+
+/**
+ *
+ * @details Releases the buffer, the capacity reached is kept for the next one.
+ * @param this
+ * @return
+ */
+int _empty_ring_queue(Queue *this){
+    struct PrivateDataRingQueue *private = (struct PrivateDataRingQueue*)this->private;
+    int r = private->size > 0;
+    free(private->slots);
+    private->slots = NULL;
+    private->head = 0;
+    private->size = 0;
+    return r;
+}
+
+/**
+ *
+ * @param this
+ * @param callback
+ */
+void _print_ring_queue(Queue *this, void(*const callback)(const void*)) {
+    struct PrivateDataRingQueue *private = (struct PrivateDataRingQueue*)this->private;
+    if(private->size > 0){
+        unsigned int i;
+        for(i = 0; i < private->size; i++){
+            if(callback != NULL)
+                callback(ring_data(private, ring_slot(private, (private->head + i) & (private->capacity - 1))));
+        }
+        printf(" NULL.\n");
+    }else{
+        printf("\nCola vacia.\n");
+    }
+}
+
+/**
+ *
+ * @param this
+ * @return
+ */
+unsigned int _get_size_ring_queue(Queue *this){
+    struct PrivateDataRingQueue *private = (struct PrivateDataRingQueue*)this->private;
+    return private->size;
+}
+
+/**
+ *
+ * @details Makes room once, then copies in at most two runs.
+ * @param this
+ * @param items n consecutive elements (void* or values), items[0] is enqueued first
+ * @param n
+ * @return elements enqueued
+ */
+unsigned int _enqueue_n_ring_queue(Queue *this, const void* items, unsigned int n){
+    struct PrivateDataRingQueue *private = (struct PrivateDataRingQueue*)this->private;
+    if(n == 0 || n > 0x80000000u - private->size || !growRingQueue(private, private->size + n))
+        return 0;
+    copy_ring(private, (private->head + private->size) & (private->capacity - 1), (unsigned char*)items, n, 1);
+    private->size += n;
+    return n;
+}
+
+/**
+ *
+ * @param this
+ * @param out room for n elements (void* or values), the front is written first
+ * @param n
+ * @return elements dequeued
+ */
+unsigned int _dequeue_n_ring_queue(Queue *this, void* out, unsigned int n){
+    struct PrivateDataRingQueue *private = (struct PrivateDataRingQueue*)this->private;
+    if(n > private->size)
+        n = private->size;
+    if(n == 0)
+        return 0;
+    copy_ring(private, private->head, (unsigned char*)out, n, 0);
+    private->head = (private->head + n) & (private->capacity - 1);
+    private->size -= n;
+    return n;
+}
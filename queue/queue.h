@@ -4,24 +4,30 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdarg.h>
+#include <string.h>
 #include <assert.h>
+#include "../pool/node_pool.h"
+#include "inline_queue.h"
 
 #ifdef	__cplusplus
 extern "C" {
 #endif
+
 typedef struct QueueADT* QueueADT, ELEMENT_QUEUE;
 typedef struct Queue Queue;
 
 struct QueueADT{
     void* data;
-    QueueADT next;
+    struct QueueADT* next;
 };
 
 typedef struct PrivateDataQueue{
-    QueueADT final;
-    QueueADT queue_adt;
+    struct QueueADT* final;
+    struct QueueADT* queue_adt;
     unsigned int size;
+    NodePool* pool;//NULL for malloc
 };
+
 struct Queue{
     void* const private;
     unsigned  int (*const get_size)(Queue *this);
@@ -31,17 +37,33 @@ struct Queue{
     int (*const empty)(Queue *this);
     void (*const print)(Queue *this, void(*const callback)(const void*));
     int (*const enqueue_multiple)(Queue *this, void(*const callback)(const void*), int count, ... );
+    unsigned int (*const enqueue_n)(Queue *this, const void* items, unsigned int n);
+    unsigned int (*const dequeue_n)(Queue *this, void* out, unsigned int n);
 };
 
 Queue newQueue();
+Queue newPooledQueue(NodePool *pool);
+Queue newRingQueue(unsigned int capacity);
+Queue newInlineQueue(unsigned int element_size, unsigned int capacity);
 void destroyQueue(Queue *queue);
-static unsigned int _get_size(Queue *this);
+static unsigned int _get_size_queue(Queue *this);
 static int _enqueue_queue(Queue *this, const void* d, void (*const callback)(const void*));
 static int _dequeue_queue(Queue *this, void(*const callback)(const void*));
 static void* _peek_queue(Queue *this);
 static int _empty_queue(Queue *this);
 static void _print_queue(Queue *this, void(*const callback)(const void*));
 static int _enqueue_multiple_queue(Queue *this, void(*const callback)(const void*), int count, ... );
+static unsigned int _enqueue_n_queue(Queue *this, const void* items, unsigned int n);
+static unsigned int _dequeue_n_queue(Queue *this, void* out, unsigned int n);
+static Queue newRingQueueOf(unsigned int capacity, unsigned int element_size, int by_value);
+static unsigned int _get_size_ring_queue(Queue *this);
+static int _enqueue_ring_queue(Queue *this, const void* d, void (*const callback)(const void*));
+static int _dequeue_ring_queue(Queue *this, void(*const callback)(const void*));
+static void* _peek_ring_queue(Queue *this);
+static int _empty_ring_queue(Queue *this);
+static void _print_ring_queue(Queue *this, void(*const callback)(const void*));
+static unsigned int _enqueue_n_ring_queue(Queue *this, const void* items, unsigned int n);
+static unsigned int _dequeue_n_ring_queue(Queue *this, void* out, unsigned int n);
 
 
 #ifdef	__cplusplus
@@ -0,0 +1,84 @@
+#ifndef QUEUE_HPP
+#define QUEUE_HPP
+
+#include <cstring>
+#include <type_traits>
+
+#include "inline_queue.h"
+
+namespace ds {
+
+/**
+ * Inline ring queue of T (see newInlineQueue) whose push/pop are plain
+ * member functions the compiler can inline; only growing the buffer calls
+ * into queue.c. c_queue() hands the same storage to the C API of queue.h,
+ * from a C translation unit.
+ */
+template<typename T>
+class queue {
+    static_assert(std::is_trivially_copyable<T>::value, "ds::queue stores T with memcpy");
+
+public:
+    explicit queue(unsigned int capacity = QUEUE_RING_CAPACITY)
+        : queue_(newInlineQueuePtr(sizeof(T), capacity)),
+          private_(getPrivateDataRingQueue(queue_)) {}
+
+    ~queue() { destroyQueuePtr(queue_); }
+
+    queue(const queue&) = delete;
+    queue& operator=(const queue&) = delete;
+
+    /**
+     *
+     * @param value
+     * @return false if out of memory
+     */
+    bool push(const T& value) {
+        if (private_->slots == nullptr || private_->size == private_->capacity) {
+            if (!growRingQueue(private_, private_->size + 1))
+                return false;
+        }
+        unsigned int tail = (private_->head + private_->size) & (private_->capacity - 1);
+        std::memcpy(private_->slots + tail * sizeof(T), &value, sizeof(T));
+        private_->size++;
+        return true;
+    }
+
+    /**
+     *
+     * @param value receives the front
+     * @return false if empty
+     */
+    bool pop(T& value) {
+        if (private_->size == 0)
+            return false;
+        std::memcpy(&value, private_->slots + private_->head * sizeof(T), sizeof(T));
+        private_->head = (private_->head + 1) & (private_->capacity - 1);
+        private_->size--;
+        return true;
+    }
+
+    /**
+     *
+     * @details Must not be empty.
+     * @return copy of the front
+     */
+    T front() const {
+        T value;
+        std::memcpy(&value, private_->slots + private_->head * sizeof(T), sizeof(T));
+        return value;
+    }
+
+    unsigned int size() const { return private_->size; }
+    bool empty() const { return private_->size == 0; }
+    void clear() { clearQueue(queue_); }
+    Queue* c_queue() { return queue_; }
+
+private:
+    Queue* const queue_;
+    PrivateDataRingQueue* const private_;
+};
+
+}
+
+#endif
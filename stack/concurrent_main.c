@@ -0,0 +1,69 @@
+/*
+ * File:   concurrent_main.c
+ * Author: regoeco
+ *
+ * Stress run of ConcurrentStack: every thread pushes its own numbers and
+ * pops as many elements as it pushed, mixed; at the end every number must
+ * have been popped exactly once.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include "concurrent_stack.h"
+
+#define NUM_THREADS 8
+#ifndef NUM_ITEMS
+#define NUM_ITEMS 200000
+#endif
+
+ConcurrentStack *stack;
+int numbers[NUM_THREADS*NUM_ITEMS];
+atomic_int seen[NUM_THREADS*NUM_ITEMS];
+
+void* worker(void* arg){
+    int t = (int)(long)arg;
+    int i, popped = 0;
+    void* d;
+    for(i = 0; i < NUM_ITEMS; i++){
+        stack->push(stack, &numbers[t*NUM_ITEMS + i], NULL);
+        if((i & 1) && stack->take(stack, &d)){
+            atomic_fetch_add(&seen[*(int*)d], 1);
+            popped++;
+        }
+    }
+    while(popped < NUM_ITEMS && stack->take(stack, &d)){
+        atomic_fetch_add(&seen[*(int*)d], 1);
+        popped++;
+    }
+    return NULL;
+}
+
+//MAIN
+int main(int argc, char** argv)
+{
+    pthread_t threads[NUM_THREADS];
+    int i, errors = 0;
+    void* d;
+
+    ConcurrentStack s = newConcurrentStack();
+    stack = &s;
+    for(i = 0; i < NUM_THREADS*NUM_ITEMS; i++)
+        numbers[i] = i;
+
+    for(i = 0; i < NUM_THREADS; i++)
+        pthread_create(&threads[i], NULL, worker, (void*)(long)i);
+    for(i = 0; i < NUM_THREADS; i++)
+        pthread_join(threads[i], NULL);
+
+    //WHAT THE WORKERS LEFT
+    while(stack->take(stack, &d))
+        atomic_fetch_add(&seen[*(int*)d], 1);
+
+    for(i = 0; i < NUM_THREADS*NUM_ITEMS; i++)
+        if(atomic_load(&seen[i]) != 1)
+            errors++;
+    printf("Threads:%d Items:%d Size:%u Errors:%d\n", NUM_THREADS, NUM_THREADS*NUM_ITEMS, stack->get_size(stack), errors);
+
+    destroyConcurrentStack(stack);
+    return errors == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
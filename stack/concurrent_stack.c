@@ -0,0 +1,204 @@
+#include "concurrent_stack.h"
+
+#define TAGGED(tag, index) (((unsigned long long)(tag) << 32) | (unsigned long long)(index))
+#define TAG(head) ((unsigned int)((head) >> 32))
+#define INDEX(head) ((unsigned int)(head))
+
+/**
+ *
+ * @return ConcurrentStack
+ */
+ConcurrentStack newConcurrentStack(){
+    PrivateDataConcurrentStack* p = calloc(1, sizeof(PrivateDataConcurrentStack));
+    atomic_init(&p->head, 0);
+    atomic_init(&p->free_head, 0);
+    atomic_init(&p->next_node, 0);
+    atomic_init(&p->size, 0);
+    ConcurrentStack stack = {
+        .private = p,
+        .get_size = _get_size_concurrent_stack,
+        .push = _push_concurrent_stack,
+        .pop = _pop_concurrent_stack,
+        .take = _take_concurrent_stack,
+        .peek = _peek_concurrent_stack,
+        .empty = _empty_concurrent_stack
+    };
+    return stack;
+}
+
+/**
+ *
+ * @details Not thread safe, every other thread must be done with the stack.
+ * @param this
+ */
+void destroyConcurrentStack(ConcurrentStack *this){
+    PrivateDataConcurrentStack *private = (PrivateDataConcurrentStack*)this->private;
+    unsigned int i;
+    for(i = 0; i < CONCURRENT_STACK_MAX_CHUNKS; i++)
+        free(atomic_load_explicit(&private->chunks[i], memory_order_relaxed));
+    free(private);
+}
+
+/**
+ *
+ * @param private
+ * @param index 1-based
+ * @return
+ */
+static ConcurrentStackNode* node_at(PrivateDataConcurrentStack *private, unsigned int index){
+    index--;
+    ConcurrentStackNode *chunk = atomic_load_explicit(&private->chunks[index/CONCURRENT_STACK_CHUNK_NODES], memory_order_acquire);
+    return &chunk[index%CONCURRENT_STACK_CHUNK_NODES];
+}
+
+/**
+ *
+ * @details Treiber push of an already owned node on one of the two heads.
+ * @param private
+ * @param head
+ * @param index
+ */
+static void link_node(PrivateDataConcurrentStack *private, atomic_ullong *head, unsigned int index){
+    ConcurrentStackNode *node = node_at(private, index);
+    unsigned long long old = atomic_load_explicit(head, memory_order_relaxed);
+    do{
+        atomic_store_explicit(&node->next, INDEX(old), memory_order_relaxed);
+    }while(!atomic_compare_exchange_weak_explicit(head, &old, TAGGED(TAG(old) + 1, index),
+                                                  memory_order_release, memory_order_relaxed));
+}
+
+/**
+ *
+ * @details Treiber pop on one of the two heads, the tag turns a CAS against
+ * a node that was popped and pushed again in between into a failure.
+ * @param private
+ * @param head
+ * @return index of the node now owned by the caller, 0 if empty
+ */
+static unsigned int unlink_node(PrivateDataConcurrentStack *private, atomic_ullong *head){
+    unsigned long long old = atomic_load_explicit(head, memory_order_acquire);
+    while(INDEX(old) != 0){
+        unsigned int next = atomic_load_explicit(&node_at(private, INDEX(old))->next, memory_order_relaxed);
+        if(atomic_compare_exchange_weak_explicit(head, &old, TAGGED(TAG(old) + 1, next),
+                                                 memory_order_acquire, memory_order_acquire))
+            return INDEX(old);
+    }
+    return 0;
+}
+
+/**
+ *
+ * @param private
+ * @return index of a free node, 0 if the stack is full or out of memory
+ */
+static unsigned int alloc_node(PrivateDataConcurrentStack *private){
+    unsigned int index = unlink_node(private, &private->free_head);
+    if(index != 0)
+        return index;
+    index = atomic_fetch_add_explicit(&private->next_node, 1, memory_order_relaxed);
+    if(index >= CONCURRENT_STACK_CHUNK_NODES*CONCURRENT_STACK_MAX_CHUNKS)
+        return 0;
+    _Atomic(ConcurrentStackNode*) *slot = &private->chunks[index/CONCURRENT_STACK_CHUNK_NODES];
+    if(atomic_load_explicit(slot, memory_order_acquire) == NULL){
+        ConcurrentStackNode *expected = NULL;
+        ConcurrentStackNode *chunk = calloc(CONCURRENT_STACK_CHUNK_NODES, sizeof(ConcurrentStackNode));
+        if(chunk == NULL)
+            return 0;
+        if(!atomic_compare_exchange_strong_explicit(slot, &expected, chunk, memory_order_acq_rel, memory_order_acquire))
+            free(chunk);
+    }
+    return index + 1;
+}
+
+/**
+ *
+ * @param this
+ * @param d
+ * @param callback
+ * @return
+ */
+int _push_concurrent_stack(ConcurrentStack *this, void* d, void(*const callback)(const void*)){
+    PrivateDataConcurrentStack *private = (PrivateDataConcurrentStack*)this->private;
+    unsigned int index = alloc_node(private);
+    if(index == 0)
+        return 0;
+    //CODE HERE
+    if(callback != NULL)
+        callback(d);
+    //END
+    atomic_store_explicit(&node_at(private, index)->data, d, memory_order_relaxed);
+    link_node(private, &private->head, index);
+    atomic_fetch_add_explicit(&private->size, 1, memory_order_relaxed);
+    return 1;
+}
+
+/**
+ *
+ * @param this
+ * @param d receives the popped element
+ * @return
+ */
+int _take_concurrent_stack(ConcurrentStack *this, void** d){
+    PrivateDataConcurrentStack *private = (PrivateDataConcurrentStack*)this->private;
+    unsigned int index = unlink_node(private, &private->head);
+    if(index == 0)
+        return 0;
+    *d = atomic_load_explicit(&node_at(private, index)->data, memory_order_relaxed);
+    atomic_fetch_sub_explicit(&private->size, 1, memory_order_relaxed);
+    link_node(private, &private->free_head, index);
+    return 1;
+}
+
+/**
+ *
+ * @param this
+ * @param callback
+ * @return
+ */
+int _pop_concurrent_stack(ConcurrentStack *this, void(*const callback)(const void*)){
+    void* d;
+    if(!_take_concurrent_stack(this, &d))
+        return 0;
+    //CODE HERE
+    if(callback != NULL)
+        callback(d);
+    //END
+    return 1;
+}
+
+/**
+ *
+ * @details The element may be popped by another thread right after.
+ * @param this
+ * @return
+ */
+void* _peek_concurrent_stack(ConcurrentStack *this){
+    PrivateDataConcurrentStack *private = (PrivateDataConcurrentStack*)this->private;
+    unsigned long long head = atomic_load_explicit(&private->head, memory_order_acquire);
+    if(INDEX(head) == 0)
+        return NULL;
+    return atomic_load_explicit(&node_at(private, INDEX(head))->data, memory_order_relaxed);
+}
+
+/**
+ *
+ * @param this
+ * @return
+ */
+int _empty_concurrent_stack(ConcurrentStack *this){
+    void* d;
+    int r = 0;
+    while(_take_concurrent_stack(this, &d))
+        r = 1;
+    return r;
+}
+
+/**
+ *
+ * @param this
+ * @return
+ */
+unsigned int _get_size_concurrent_stack(ConcurrentStack *this){
+    PrivateDataConcurrentStack *private = (PrivateDataConcurrentStack*)this->private;
+    return atomic_load_explicit(&private->size, memory_order_relaxed);
+}
@@ -0,0 +1,60 @@
+#ifndef CONCURRENT_STACK_H
+#define CONCURRENT_STACK_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+/**
+ * Lock-free (Treiber) stack. Nodes live in chunks that are only released
+ * by destroyConcurrentStack, popped nodes go back to a lock-free free list,
+ * so a thread that lost a race can still read the node it loaded. Both
+ * heads pack a 32-bit node index with a 32-bit tag bumped on every change,
+ * which makes a CAS on a recycled node fail (ABA).
+ */
+#define CONCURRENT_STACK_CHUNK_NODES 4096
+#define CONCURRENT_STACK_MAX_CHUNKS 4096
+
+typedef struct ConcurrentStackNode ConcurrentStackNode;
+typedef struct ConcurrentStack ConcurrentStack;
+
+struct ConcurrentStackNode{
+    _Atomic(void*) data;
+    atomic_uint next;//index + 1 of the node below, 0 for none
+};
+
+typedef struct PrivateDataConcurrentStack{
+    atomic_ullong head;//tag << 32 | (index + 1)
+    atomic_ullong free_head;
+    atomic_uint next_node;//first never used index
+    atomic_uint size;
+    _Atomic(ConcurrentStackNode*) chunks[CONCURRENT_STACK_MAX_CHUNKS];
+}PrivateDataConcurrentStack;
+
+struct ConcurrentStack{
+    void* const private;
+    unsigned int (*const get_size)(ConcurrentStack *this);
+    int (*const push)(ConcurrentStack *this, void* d, void(*const callback)(const void*));
+    int (*const pop)(ConcurrentStack *this, void(*const callback)(const void*));
+    int (*const take)(ConcurrentStack *this, void** d);
+    void* (*const peek)(ConcurrentStack *this);
+    int (*const empty)(ConcurrentStack *this);
+};
+
+ConcurrentStack newConcurrentStack();
+void destroyConcurrentStack(ConcurrentStack *this);
+static unsigned int _get_size_concurrent_stack(ConcurrentStack *this);
+static int _push_concurrent_stack(ConcurrentStack *this, void* d, void(*const callback)(const void*));
+static int _pop_concurrent_stack(ConcurrentStack *this, void(*const callback)(const void*));
+static int _take_concurrent_stack(ConcurrentStack *this, void** d);
+static void* _peek_concurrent_stack(ConcurrentStack *this);
+static int _empty_concurrent_stack(ConcurrentStack *this);
+
+#ifdef	__cplusplus
+}
+#endif
+#endif
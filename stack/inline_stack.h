@@ -0,0 +1,47 @@
+#ifndef INLINE_STACK_H
+#define INLINE_STACK_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+/**
+ * Storage of a chunked stack, the part of stack.h a caller needs to push
+ * and pop inline values without going through the Stack methods (see
+ * stack.hpp). Names nothing that is a C++ keyword, stack.h includes it.
+ */
+#define STACK_CHUNK_SIZE 256
+
+typedef struct Stack Stack;
+
+/**
+ * Block of slots of a chunked stack, chained from the top chunk down. Slot
+ * i starts at slots + i*element_size and holds a void* or, for an inline
+ * stack, the value itself.
+ */
+struct StackChunk{
+    struct StackChunk* prev;
+    unsigned char slots[];
+};
+
+typedef struct PrivateDataChunkedStack{
+    struct StackChunk* chunk;//top chunk
+    struct StackChunk* spare;//last emptied chunk, kept so a push/pop at a boundary does not allocate
+    unsigned int top;//used slots of the top chunk
+    unsigned int chunk_size;
+    unsigned int element_size;
+    int by_value;//slots hold copies of the values instead of pointers
+    unsigned int size;
+}PrivateDataChunkedStack;
+
+Stack* newInlineStackPtr(unsigned int element_size, unsigned int chunk_size);
+void destroyStackPtr(Stack *stack);
+void clearStack(Stack *stack);
+struct PrivateDataChunkedStack* getPrivateDataChunkedStack(Stack *stack);
+int reserveStackChunk(struct PrivateDataChunkedStack *data);
+void releaseStackChunk(struct PrivateDataChunkedStack *data);
+
+#ifdef	__cplusplus
+}
+#endif
+#endif
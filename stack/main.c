@@ -6,8 +6,14 @@
  */
 #include <stdio.h>
 #include <stdlib.h>
+#include <pthread.h>
 #include "stack.h"
 
+#define CHURN_ROUNDS 32
+#define CHURN_ITEMS 1000
+#define CHURN_THREADS 4
+#define CHURN_THREAD_ITEMS 48
+
 //INTERFACE OF CALLBACKS
 void callback_push(const void*);
 void callback_pop(const void*);
@@ -18,6 +24,55 @@ typedef struct {
     int number;
 } struct_number;
 
+/**
+ *
+ * @details Pushes and pops CHURN_ITEMS numbers a round through a pooled
+ * stack; popped nodes must be reused, never carved again.
+ * @param pool
+ * @return number of mismatches
+ */
+int churn_pooled(NodePool *pool){
+    static struct_number n[CHURN_ITEMS];
+    unsigned int slabs = 0;
+    int round, i, errors = 0;
+    for(round = 0; round < CHURN_ROUNDS; round++){
+        Stack stack = newPooledStack(pool);
+        for(i = 0; i < CHURN_ITEMS; i++){
+            n[i].number = i;
+            stack.push(&stack, &n[i], NULL);
+        }
+        for(i = CHURN_ITEMS - 1; i >= 0; i--){
+            struct_number *s = (struct_number*)stack.peek(&stack);
+            if(s == NULL || s->number != i)
+                errors++;
+            stack.pop(&stack, NULL);
+        }
+        destroyStack(&stack);
+        if(round == 0)
+            slabs = pool->get_num_slabs(pool);
+    }
+    if(pool->get_num_slabs(pool) != slabs)
+        errors++;
+    return errors;
+}
+
+/**
+ *
+ * @details Leaves nodes in the cache of the thread when it returns.
+ * @param pool
+ * @return
+ */
+void* churn_thread(void* pool){
+    struct_number n[CHURN_THREAD_ITEMS];
+    Stack stack = newPooledStack((NodePool*)pool);
+    int i;
+    for(i = 0; i < CHURN_THREAD_ITEMS; i++)
+        stack.push(&stack, &n[i], NULL);
+    while(stack.pop(&stack, NULL));
+    destroyStack(&stack);
+    return NULL;
+}
+
 //MAIN
 int main(int argc, char** argv)
 {
@@ -46,24 +101,41 @@ int main(int argc, char** argv)
 
     //DESTROY STACK
     destroyStack(&stack);
-    printf("Size:%d\n", stack.get_size(&stack));
-    return (EXIT_SUCCESS);
+
+    //POOLED CHURN, ON THIS THREAD AND ON THREADS THAT EXIT
+    NodePool pool = newNodePool(sizeof(ELEMENT_STACK), 0);
+    pthread_t threads[CHURN_THREADS];
+    int errors = churn_pooled(&pool);
+    unsigned int slabs = pool.get_num_slabs(&pool);
+    for(i = 0; i < CHURN_ROUNDS; i++){
+        int t;
+        for(t = 0; t < CHURN_THREADS; t++)
+            pthread_create(&threads[t], NULL, churn_thread, &pool);
+        for(t = 0; t < CHURN_THREADS; t++)
+            pthread_join(threads[t], NULL);
+    }
+    //AN EXITED THREAD HANDS ITS CACHE BACK, NOTHING IS CARVED TWICE
+    if(pool.get_num_slabs(&pool) != slabs)
+        errors++;
+    printf("\nSlabs:%u Errors:%d\n", pool.get_num_slabs(&pool), errors);
+    destroyNodePool(&pool);
+    return errors == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
 }
 
 
 void callback_push(const void* new_data) {
-    struct_number *s = new_data;
+    const struct_number *s = new_data;
     printf("Data to insert: %d.\n", s->number);
 }
 
 void callback_pop(const void* delete_data)
 {
-    struct_number *s = delete_data;
+    const struct_number *s = delete_data;
     printf("Data to delete:  %d.\n", s->number);
 }
 
 void callback_print(const void* d)
 {
-    struct_number *s = d;
+    const struct_number *s = d;
     printf("(%d) --> ",s->number);
 }
\ No newline at end of file
@@ -5,18 +5,128 @@
  * @return Stack
  */
 Stack newStack(){
+    return newPooledStack(NULL);
+}
+
+/**
+ *
+ * @details Nodes come from pool, which must outlive the stack. A pool with
+ * nodes smaller than a StackADT is ignored.
+ * @param pool NULL for malloc
+ * @return Stack
+ */
+Stack newPooledStack(NodePool *pool){
     struct PrivateDataStack* p = malloc(sizeof(struct PrivateDataStack));
     p->size = 0;
     p->stack_adt = NULL;
+    p->pool = acceptNodePool(pool, sizeof(ELEMENT_STACK));
     Stack stack = {
         .private = p,
-        .get_size = _get_size,
+        .get_size = _get_size_stack,
         .empty = _empty_stack,
         .peek = _peek_stack,
         .pop = _pop_stack,
         .print = _print_stack,
         .push = _push_stack,
-        .push_multiple = _push_multiple_stack
+        .push_multiple = _push_multiple_stack,
+        .push_n = _push_n_stack,
+        .pop_n = _pop_n_stack
+    };
+    return stack;
+}
+
+/**
+ *
+ * @details Elements are kept in chunks of chunk_size slots, push and pop
+ * only move an index except when they cross a chunk boundary.
+ * @param chunk_size slots per chunk, 0 for STACK_CHUNK_SIZE
+ * @return Stack
+ */
+Stack newChunkedStack(unsigned int chunk_size){
+    return newChunkedStackOf(chunk_size, sizeof(void*), 0);
+}
+
+/**
+ *
+ * @details Values of element_size bytes are copied into the chunks, push
+ * takes the address of the value and pop_n copies values out, so small
+ * payloads need no allocation of their own.
+ * @param element_size
+ * @param chunk_size slots per chunk, 0 for STACK_CHUNK_SIZE
+ * @return Stack
+ */
+Stack newInlineStack(unsigned int element_size, unsigned int chunk_size){
+    return newChunkedStackOf(chunk_size, element_size > 0 ? element_size : 1, 1);
+}
+
+/**
+ *
+ * @details Heap allocated newInlineStack, for callers that only see
+ * inline_stack.h.
+ * @param element_size
+ * @param chunk_size slots per chunk, 0 for STACK_CHUNK_SIZE
+ * @return
+ */
+Stack* newInlineStackPtr(unsigned int element_size, unsigned int chunk_size){
+    Stack *stack = malloc(sizeof(Stack));
+    Stack s = newInlineStack(element_size, chunk_size);
+    memcpy(stack, &s, sizeof(Stack));
+    return stack;
+}
+
+/**
+ *
+ * @param stack from newInlineStackPtr
+ */
+void destroyStackPtr(Stack *stack){
+    destroyStack(stack);
+    free(stack);
+}
+
+/**
+ *
+ * @param stack
+ */
+void clearStack(Stack *stack){
+    stack->empty(stack);
+}
+
+/**
+ *
+ * @param stack chunked or inline
+ * @return
+ */
+struct PrivateDataChunkedStack* getPrivateDataChunkedStack(Stack *stack){
+    return (struct PrivateDataChunkedStack*)stack->private;
+}
+
+/**
+ *
+ * @param chunk_size
+ * @param element_size
+ * @param by_value
+ * @return Stack
+ */
+static Stack newChunkedStackOf(unsigned int chunk_size, unsigned int element_size, int by_value){
+    struct PrivateDataChunkedStack* p = malloc(sizeof(struct PrivateDataChunkedStack));
+    p->chunk = NULL;
+    p->spare = NULL;
+    p->top = 0;
+    p->chunk_size = chunk_size > 0 ? chunk_size : STACK_CHUNK_SIZE;
+    p->element_size = element_size;
+    p->by_value = by_value;
+    p->size = 0;
+    Stack stack = {
+        .private = p,
+        .get_size = _get_size_chunked_stack,
+        .empty = _empty_chunked_stack,
+        .peek = _peek_chunked_stack,
+        .pop = _pop_chunked_stack,
+        .print = _print_chunked_stack,
+        .push = _push_chunked_stack,
+        .push_multiple = _push_multiple_stack,
+        .push_n = _push_n_chunked_stack,
+        .pop_n = _pop_n_chunked_stack
     };
     return stack;
 }
@@ -42,7 +152,7 @@ int _push_stack(Stack *this, void* d, void(*const callback)(const void*)) {
     StackADT new;
     struct PrivateDataStack *private = (struct PrivateDataStack*)this->private;
 
-    new = (StackADT)malloc(sizeof(ELEMENT_STACK));
+    new = (StackADT)allocNode(private->pool, sizeof(ELEMENT_STACK));
     if(new != NULL){
         //CODE HERE
         if(callback != NULL)
@@ -74,7 +184,7 @@ int _pop_stack(Stack *this, void(*const callback)(const void*)) {
             callback(p->data);
         //END
         private->stack_adt = p->next;
-        free(p);
+        releaseNode(private->pool, p);
         private->size--;
         return 1;
     }else return 0;
@@ -154,12 +264,285 @@ int _push_multiple_stack(Stack *this, void(*const callback)(const void*), int co
     return r;
 }
 
+/**
+ *
+ * @details items[0] is pushed first, items[n - 1] ends on top.
+ * @param this
+ * @param items n consecutive void*
+ * @param n
+ * @return elements pushed
+ */
+unsigned int _push_n_stack(Stack *this, const void* items, unsigned int n){
+    struct PrivateDataStack *private = (struct PrivateDataStack*)this->private;
+    void* const* d = (void* const*)items;
+    unsigned int i;
+    for(i = 0; i < n; i++){
+        StackADT new = (StackADT)allocNode(private->pool, sizeof(ELEMENT_STACK));
+        if(new == NULL)
+            break;
+        new->data = d[i];
+        new->next = private->stack_adt;
+        private->stack_adt = new;
+    }
+    private->size += i;
+    return i;
+}
+
+/**
+ *
+ * @details out[0] receives the top.
+ * @param this
+ * @param out room for n void*
+ * @param n
+ * @return elements popped
+ */
+unsigned int _pop_n_stack(Stack *this, void* out, unsigned int n){
+    struct PrivateDataStack *private = (struct PrivateDataStack*)this->private;
+    void** d = (void**)out;
+    unsigned int i;
+    for(i = 0; i < n && private->size > 0; i++){
+        StackADT p = private->stack_adt;
+        d[i] = p->data;
+        private->stack_adt = p->next;
+        releaseNode(private->pool, p);
+        private->size--;
+    }
+    return i;
+}
+
 /**
  *
  * @param this
  * @return
  */
-unsigned int _get_size(Stack *this){
+unsigned int _get_size_stack(Stack *this){
     struct PrivateDataStack *private = (struct PrivateDataStack*)this->private;
     return private->size;
-}
\ No newline at end of file
+}
+
+/**
+ *
+ * @param private
+ * @param chunk
+ * @param i slot index in the chunk
+ * @return address of the slot
+ */
+static void* chunk_slot(struct PrivateDataChunkedStack *private, StackChunk chunk, unsigned int i){
+    return chunk->slots + (size_t)i*private->element_size;
+}
+
+/**
+ *
+ * @param private
+ * @param slot
+ * @return what callbacks and peek see: the stored pointer or the address of the value
+ */
+static void* slot_data(struct PrivateDataChunkedStack *private, void* slot){
+    return private->by_value ? slot : *(void**)slot;
+}
+
+/**
+ *
+ * @details Makes the top chunk have a free slot, taking the spare one if any.
+ * @param private
+ * @return
+ */
+int reserveStackChunk(struct PrivateDataChunkedStack *private){
+    if(private->chunk == NULL || private->top == private->chunk_size){
+        StackChunk new = private->spare;
+        if(new != NULL)
+            private->spare = NULL;
+        else
+            new = (StackChunk)malloc(sizeof(ELEMENT_STACK_CHUNK) + (size_t)private->chunk_size*private->element_size);
+        if(new == NULL)
+            return 0;
+        new->prev = private->chunk;
+        private->chunk = new;
+        private->top = 0;
+    }
+    return 1;
+}
+
+/**
+ *
+ * @details Drops an emptied top chunk, keeping it as the spare one.
+ * @param private
+ */
+void releaseStackChunk(struct PrivateDataChunkedStack *private){
+    if(private->top == 0 && private->chunk->prev != NULL){
+        StackChunk p = private->chunk;
+        private->chunk = p->prev;
+        private->top = private->chunk_size;
+        free(private->spare);
+        private->spare = p;
+    }
+}
+
+/**
+ *
+ * @param this
+ * @param d the element, or the address of the value to copy for an inline stack
+ * @param callback
+ * @return
+ */
+int _push_chunked_stack(Stack *this, void* d, void(*const callback)(const void*)) {
+    struct PrivateDataChunkedStack *private = (struct PrivateDataChunkedStack*)this->private;
+    if(!reserveStackChunk(private))
+        return 0;
+    //CODE HERE
+    if(callback != NULL)
+        callback(d);
+    //END
+    if(private->by_value)
+        memcpy(chunk_slot(private, private->chunk, private->top), d, private->element_size);
+    else
+        ((void**)private->chunk->slots)[private->top] = d;
+    private->top++;
+    private->size++;
+    return 1;
+}
+
+/**
+ *
+ * @details For an inline stack the callback gets the address of the value,
+ * valid only during the call.
+ * @param this
+ * @param callback
+ * @return
+ */
+int _pop_chunked_stack(Stack *this, void(*const callback)(const void*)) {
+    struct PrivateDataChunkedStack *private = (struct PrivateDataChunkedStack*)this->private;
+    if(private->size > 0){
+        void* d = slot_data(private, chunk_slot(private, private->chunk, --private->top));
+        //CODE HERE
+        if(callback != NULL)
+            callback(d);
+        //END
+        private->size--;
+        releaseStackChunk(private);
+        return 1;
+    }else return 0;
+}
+
+/**
+ *
+ * @details For an inline stack, the address of the value until the next change.
+ * @param this
+ * @return
+ */
+void* _peek_chunked_stack(Stack *this) {
+    struct PrivateDataChunkedStack *private = (struct PrivateDataChunkedStack*)this->private;
+    if(private->size > 0){
+        return slot_data(private, chunk_slot(private, private->chunk, private->top - 1));
+    }else {
+        return NULL;
+    }
+}
+
+/**
+ *
+ * @details Releases every chunk.
+ * @param this
+ * @return
+ */
+int _empty_chunked_stack(Stack *this){
+    struct PrivateDataChunkedStack *private = (struct PrivateDataChunkedStack*)this->private;
+    int r = private->size > 0;
+    while(private->chunk != NULL){
+        StackChunk p = private->chunk;
+        private->chunk = p->prev;
+        free(p);
+    }
+    free(private->spare);
+    private->spare = NULL;
+    private->top = 0;
+    private->size = 0;
+    return r;
+}
+
+/**
+ *
+ * @param this
+ * @param callback
+ */
+void _print_chunked_stack(Stack *this, void(*const callback)(const void*)) {
+    struct PrivateDataChunkedStack *private = (struct PrivateDataChunkedStack*)this->private;
+    if(private->size > 0){
+        StackChunk chunk = private->chunk;
+        unsigned int i = private->top;
+        while(chunk != NULL){
+            while(i > 0){
+                i--;
+                if(callback != NULL)
+                    callback(slot_data(private, chunk_slot(private, chunk, i)));
+            }
+            chunk = chunk->prev;
+            i = private->chunk_size;
+        }
+        printf(" NULL.\n");
+    }else{
+        printf("\nPila vacia.\n");
+    }
+}
+
+/**
+ *
+ * @param this
+ * @return
+ */
+unsigned int _get_size_chunked_stack(Stack *this){
+    struct PrivateDataChunkedStack *private = (struct PrivateDataChunkedStack*)this->private;
+    return private->size;
+}
+
+/**
+ *
+ * @details Fills the top chunk with one copy, then the next ones.
+ * @param this
+ * @param items n consecutive elements (void* or values), the last one ends on top
+ * @param n
+ * @return elements pushed
+ */
+unsigned int _push_n_chunked_stack(Stack *this, const void* items, unsigned int n){
+    struct PrivateDataChunkedStack *private = (struct PrivateDataChunkedStack*)this->private;
+    const unsigned char* d = (const unsigned char*)items;
+    unsigned int k, moved = 0;
+    while(moved < n && reserveStackChunk(private)){
+        k = private->chunk_size - private->top;
+        if(k > n - moved)
+            k = n - moved;
+        memcpy(chunk_slot(private, private->chunk, private->top), d + (size_t)moved*private->element_size,
+               (size_t)k*private->element_size);
+        private->top += k;
+        moved += k;
+    }
+    private->size += moved;
+    return moved;
+}
+
+/**
+ *
+ * @details out receives the top first.
+ * @param this
+ * @param out room for n elements (void* or values)
+ * @param n
+ * @return elements popped
+ */
+unsigned int _pop_n_chunked_stack(Stack *this, void* out, unsigned int n){
+    struct PrivateDataChunkedStack *private = (struct PrivateDataChunkedStack*)this->private;
+    unsigned char* d = (unsigned char*)out;
+    size_t element_size = private->element_size;
+    unsigned int i, k, moved = 0;
+    while(moved < n && private->size > 0){
+        k = private->top;
+        if(k > n - moved)
+            k = n - moved;
+        for(i = 0; i < k; i++)
+            memcpy(d + (moved + i)*element_size, chunk_slot(private, private->chunk, private->top - 1 - i), element_size);
+        private->top -= k;
+        private->size -= k;
+        moved += k;
+        releaseStackChunk(private);
+    }
+    return moved;
+}
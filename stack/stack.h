@@ -4,22 +4,27 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdarg.h>
+#include <string.h>
+#include "../pool/node_pool.h"
+#include "inline_stack.h"
 
 #ifdef	__cplusplus
 extern "C" {
 #endif
 
 typedef struct StackADT* StackADT, ELEMENT_STACK;
+typedef struct StackChunk* StackChunk, ELEMENT_STACK_CHUNK;
 typedef struct Stack Stack;
 
 struct StackADT{
     void* data;
-    StackADT next;
+    struct StackADT* next;
 };
 
 typedef struct PrivateDataStack{
-    StackADT stack_adt;
+    struct StackADT* stack_adt;
     unsigned int size;
+    NodePool* pool;//NULL for malloc
 };
 
 struct Stack{
@@ -31,9 +36,14 @@ struct Stack{
     int (*const empty)(Stack *this);
     void (*const print)(Stack *this, void(*const callback)(const void*));
     int (*const push_multiple)(Stack *this, void(*const callback)(const void*), int count, ... );
+    unsigned int (*const push_n)(Stack *this, const void* items, unsigned int n);
+    unsigned int (*const pop_n)(Stack *this, void* out, unsigned int n);
 };
 
 Stack newStack();
+Stack newPooledStack(NodePool *pool);
+Stack newChunkedStack(unsigned int chunk_size);
+Stack newInlineStack(unsigned int element_size, unsigned int chunk_size);
 void destroyStack(Stack *this);
 static int _pop_stack(Stack *this, void(*const callback)(const void*));
 static int _push_stack(Stack *this, void* d, void(*const callback)(const void*));
@@ -41,7 +51,18 @@ static void* _peek_stack(Stack *this);
 static int _empty_stack(Stack *this);
 static void _print_stack(Stack *this, void(*const callback)(const void*));
 static int _push_multiple_stack(Stack *this, void(*const callback)(const void*), int count, ... );
-unsigned int _get_size(Stack *this);
+static unsigned int _get_size_stack(Stack *this);
+static unsigned int _push_n_stack(Stack *this, const void* items, unsigned int n);
+static unsigned int _pop_n_stack(Stack *this, void* out, unsigned int n);
+static Stack newChunkedStackOf(unsigned int chunk_size, unsigned int element_size, int by_value);
+static int _pop_chunked_stack(Stack *this, void(*const callback)(const void*));
+static int _push_chunked_stack(Stack *this, void* d, void(*const callback)(const void*));
+static void* _peek_chunked_stack(Stack *this);
+static int _empty_chunked_stack(Stack *this);
+static void _print_chunked_stack(Stack *this, void(*const callback)(const void*));
+static unsigned int _get_size_chunked_stack(Stack *this);
+static unsigned int _push_n_chunked_stack(Stack *this, const void* items, unsigned int n);
+static unsigned int _pop_n_chunked_stack(Stack *this, void* out, unsigned int n);
 #ifdef	__cplusplus
 }
 #endif
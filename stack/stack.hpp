@@ -0,0 +1,86 @@
+#ifndef STACK_HPP
+#define STACK_HPP
+
+#include <cstring>
+#include <type_traits>
+
+#include "inline_stack.h"
+
+namespace ds {
+
+/**
+ * Inline stack of T (see newInlineStack) whose push/pop are plain member
+ * functions the compiler can inline; only crossing a chunk boundary calls
+ * into stack.c. c_stack() hands the same storage to the C API of stack.h,
+ * from a C translation unit.
+ */
+template<typename T>
+class stack {
+    static_assert(std::is_trivially_copyable<T>::value, "ds::stack stores T with memcpy");
+
+public:
+    explicit stack(unsigned int chunk_size = STACK_CHUNK_SIZE)
+        : stack_(newInlineStackPtr(sizeof(T), chunk_size)),
+          private_(getPrivateDataChunkedStack(stack_)) {}
+
+    ~stack() { destroyStackPtr(stack_); }
+
+    stack(const stack&) = delete;
+    stack& operator=(const stack&) = delete;
+
+    /**
+     *
+     * @param value
+     * @return false if out of memory
+     */
+    bool push(const T& value) {
+        if (private_->chunk == nullptr || private_->top == private_->chunk_size) {
+            if (!reserveStackChunk(private_))
+                return false;
+        }
+        std::memcpy(private_->chunk->slots + private_->top * sizeof(T), &value, sizeof(T));
+        private_->top++;
+        private_->size++;
+        return true;
+    }
+
+    /**
+     *
+     * @param value receives the top
+     * @return false if empty
+     */
+    bool pop(T& value) {
+        if (private_->size == 0)
+            return false;
+        private_->top--;
+        std::memcpy(&value, private_->chunk->slots + private_->top * sizeof(T), sizeof(T));
+        private_->size--;
+        if (private_->top == 0)
+            releaseStackChunk(private_);
+        return true;
+    }
+
+    /**
+     *
+     * @details Must not be empty.
+     * @return copy of the top
+     */
+    T top() const {
+        T value;
+        std::memcpy(&value, private_->chunk->slots + (private_->top - 1) * sizeof(T), sizeof(T));
+        return value;
+    }
+
+    unsigned int size() const { return private_->size; }
+    bool empty() const { return private_->size == 0; }
+    void clear() { clearStack(stack_); }
+    Stack* c_stack() { return stack_; }
+
+private:
+    Stack* const stack_;
+    PrivateDataChunkedStack* const private_;
+};
+
+}
+
+#endif
@@ -0,0 +1,356 @@
+#include <sched.h>
+#include <string.h>
+#include "work_stealing.h"
+
+#define STEAL_ATTEMPTS 64
+
+/**
+ * Worker the current thread is, NULL outside of a pool.
+ */
+static _Thread_local WorkStealingPool *current_pool = NULL;
+static _Thread_local int current_worker = -1;
+
+/**
+ *
+ * @param capacity
+ * @return
+ */
+static WorkDequeArray* new_array(long capacity){
+    WorkDequeArray *a = malloc(sizeof(WorkDequeArray) + capacity*sizeof(_Atomic(void*)));
+    if(a != NULL){
+        a->retired = NULL;
+        a->capacity = capacity;
+    }
+    return a;
+}
+
+/**
+ *
+ * @param capacity rounded up to a power of two, 0 for WORK_DEQUE_CAPACITY
+ * @return WorkDeque
+ */
+WorkDeque newWorkDeque(unsigned int capacity){
+    PrivateDataWorkDeque* p = NULL;
+    long c = 2;
+    if(capacity == 0)
+        capacity = WORK_DEQUE_CAPACITY;
+    while(c < capacity)
+        c <<= 1;
+    if(posix_memalign((void**)&p, 64, sizeof(PrivateDataWorkDeque)) != 0)
+        p = NULL;
+    if(p != NULL){
+        atomic_init(&p->top, 0);
+        atomic_init(&p->bottom, 0);
+        atomic_init(&p->array, new_array(c));
+    }
+    WorkDeque deque = {
+        .private = p,
+        .get_size = _get_size_work_deque,
+        .push = _push_work_deque,
+        .pop = _pop_work_deque,
+        .steal = _steal_work_deque
+    };
+    return deque;
+}
+
+/**
+ *
+ * @details No other thread may be using the deque.
+ * @param this
+ */
+void destroyWorkDeque(WorkDeque *this){
+    PrivateDataWorkDeque *private = (PrivateDataWorkDeque*)this->private;
+    WorkDequeArray *a = atomic_load_explicit(&private->array, memory_order_relaxed);
+    while(a != NULL){
+        WorkDequeArray *retired = a->retired;
+        free(a);
+        a = retired;
+    }
+    free(private);
+}
+
+/**
+ *
+ * @details Owner only.
+ * @param this
+ * @param d
+ * @return 0 if out of memory
+ */
+int _push_work_deque(WorkDeque *this, void* d){
+    PrivateDataWorkDeque *private = (PrivateDataWorkDeque*)this->private;
+    long b = atomic_load_explicit(&private->bottom, memory_order_relaxed);
+    long t = atomic_load_explicit(&private->top, memory_order_acquire);
+    WorkDequeArray *a = atomic_load_explicit(&private->array, memory_order_relaxed);
+    if(b - t > a->capacity - 1){
+        WorkDequeArray *bigger = new_array(a->capacity << 1);
+        long i;
+        if(bigger == NULL)
+            return 0;
+        for(i = t; i < b; i++)
+            atomic_store_explicit(&bigger->slots[i & (bigger->capacity - 1)],
+                                  atomic_load_explicit(&a->slots[i & (a->capacity - 1)], memory_order_relaxed),
+                                  memory_order_relaxed);
+        bigger->retired = a;
+        atomic_store_explicit(&private->array, bigger, memory_order_release);
+        a = bigger;
+    }
+    atomic_store_explicit(&a->slots[b & (a->capacity - 1)], d, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&private->bottom, b + 1, memory_order_relaxed);
+    return 1;
+}
+
+/**
+ *
+ * @details Owner only, takes the newest element.
+ * @param this
+ * @param d receives the element
+ * @return 0 if empty
+ */
+int _pop_work_deque(WorkDeque *this, void** d){
+    PrivateDataWorkDeque *private = (PrivateDataWorkDeque*)this->private;
+    long b = atomic_load_explicit(&private->bottom, memory_order_relaxed) - 1;
+    WorkDequeArray *a = atomic_load_explicit(&private->array, memory_order_relaxed);
+    long t;
+    int r = 1;
+    atomic_store_explicit(&private->bottom, b, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    t = atomic_load_explicit(&private->top, memory_order_relaxed);
+    if(t <= b){
+        *d = atomic_load_explicit(&a->slots[b & (a->capacity - 1)], memory_order_relaxed);
+        if(t == b){
+            //last element, race the thieves for it
+            if(!atomic_compare_exchange_strong_explicit(&private->top, &t, t + 1,
+                                                        memory_order_seq_cst, memory_order_relaxed))
+                r = 0;
+            atomic_store_explicit(&private->bottom, b + 1, memory_order_relaxed);
+        }
+    }else{
+        r = 0;
+        atomic_store_explicit(&private->bottom, b + 1, memory_order_relaxed);
+    }
+    return r;
+}
+
+/**
+ *
+ * @details Any thread, takes the oldest element.
+ * @param this
+ * @param d receives the element
+ * @return 1 on success, 0 if empty, -1 if another thread won the element
+ */
+int _steal_work_deque(WorkDeque *this, void** d){
+    PrivateDataWorkDeque *private = (PrivateDataWorkDeque*)this->private;
+    long t = atomic_load_explicit(&private->top, memory_order_acquire);
+    long b;
+    atomic_thread_fence(memory_order_seq_cst);
+    b = atomic_load_explicit(&private->bottom, memory_order_acquire);
+    if(t < b){
+        WorkDequeArray *a = atomic_load_explicit(&private->array, memory_order_acquire);
+        void* x = atomic_load_explicit(&a->slots[t & (a->capacity - 1)], memory_order_relaxed);
+        if(!atomic_compare_exchange_strong_explicit(&private->top, &t, t + 1,
+                                                    memory_order_seq_cst, memory_order_relaxed))
+            return -1;
+        *d = x;
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ *
+ * @details Only a hint while other threads are running.
+ * @param this
+ * @return
+ */
+unsigned int _get_size_work_deque(WorkDeque *this){
+    PrivateDataWorkDeque *private = (PrivateDataWorkDeque*)this->private;
+    long b = atomic_load_explicit(&private->bottom, memory_order_relaxed);
+    long t = atomic_load_explicit(&private->top, memory_order_relaxed);
+    return b > t ? (unsigned int)(b - t) : 0;
+}
+
+/**
+ *
+ * @details Own deque first, then the others from a rotating victim, then
+ * the injected tasks.
+ * @param this
+ * @param index
+ * @param d
+ * @return 1 if a task was found
+ */
+static int find_task(WorkStealingPool *this, int index, void** d){
+    int i, r;
+    if(this->deques[index].pop(&this->deques[index], d))
+        return 1;
+    for(i = 1; i < STEAL_ATTEMPTS; i++){
+        WorkDeque *victim = &this->deques[(index + i) % this->num_threads];
+        if(victim == &this->deques[index])
+            continue;
+        r = victim->steal(victim, d);
+        if(r == 1){
+            atomic_fetch_add_explicit(&this->num_steals, 1, memory_order_relaxed);
+            return 1;
+        }
+    }
+    r = 0;
+    pthread_mutex_lock(&this->lock);
+    if(this->injected.get_size(&this->injected) > 0){
+        *d = this->injected.peek(&this->injected);
+        this->injected.pop(&this->injected, NULL);
+        r = 1;
+    }
+    pthread_mutex_unlock(&this->lock);
+    return r;
+}
+
+/**
+ *
+ * @param this
+ */
+static void task_done(WorkStealingPool *this){
+    if(atomic_fetch_sub_explicit(&this->pending, 1, memory_order_acq_rel) == 1){
+        pthread_mutex_lock(&this->lock);
+        pthread_cond_broadcast(&this->done);
+        pthread_mutex_unlock(&this->lock);
+    }
+}
+
+/**
+ *
+ * @param p
+ * @return
+ */
+static void *worker(void *p){
+    WorkStealingPool *this = p;
+    int index = atomic_fetch_add_explicit(&this->num_started, 1, memory_order_relaxed);
+    void* d;
+    current_pool = this;
+    current_worker = index;
+    for(;;){
+        if(find_task(this, index, &d)){
+            this->task(this, this->arg, d);
+            task_done(this);
+            continue;
+        }
+        if(atomic_load_explicit(&this->pending, memory_order_acquire) > 0){
+            sched_yield();
+            continue;
+        }
+        //nothing left, sleep until a spawn from outside
+        pthread_mutex_lock(&this->lock);
+        while(!this->stop && atomic_load_explicit(&this->pending, memory_order_acquire) == 0)
+            pthread_cond_wait(&this->work, &this->lock);
+        if(this->stop){
+            pthread_mutex_unlock(&this->lock);
+            break;
+        }
+        pthread_mutex_unlock(&this->lock);
+    }
+    return NULL;
+}
+
+/**
+ *
+ * @param num_threads
+ * @param task
+ * @param arg
+ * @return
+ */
+WorkStealingPool *newWorkStealingPool(int num_threads, void (*task)(WorkStealingPool *pool, void *arg, void *d), void *arg){
+    WorkStealingPool *pool = malloc(sizeof(WorkStealingPool));
+    int i;
+    if(num_threads < 1)
+        num_threads = 1;
+    pool->num_threads = num_threads;
+    pool->threads = malloc(sizeof(pthread_t)*num_threads);
+    pool->deques = malloc(sizeof(WorkDeque)*num_threads);
+    for(i = 0; i < num_threads; i++){
+        WorkDeque deque = newWorkDeque(WORK_DEQUE_CAPACITY);
+        memcpy(&pool->deques[i], &deque, sizeof(WorkDeque));
+    }
+    Stack injected = newChunkedStack(STACK_CHUNK_SIZE);
+    memcpy(&pool->injected, &injected, sizeof(Stack));
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work, NULL);
+    pthread_cond_init(&pool->done, NULL);
+    atomic_init(&pool->pending, 0);
+    atomic_init(&pool->num_steals, 0);
+    atomic_init(&pool->num_started, 0);
+    pool->num_created = 0;
+    pool->stop = 0;
+    pool->task = task;
+    pool->arg = arg;
+    pool->spawn = _spawn_work_stealing_pool;
+    pool->wait = _wait_work_stealing_pool;
+    pool->get_num_threads = _get_num_threads_work_stealing_pool;
+    for(i = 0; i < num_threads; i++){
+        if(pthread_create(&pool->threads[i], NULL, worker, pool) != 0)
+            break;
+        pool->num_created++;
+    }
+    return pool;
+}
+
+/**
+ *
+ * @details Waits for the workers to finish the tasks they are running.
+ * @param this
+ */
+void destroyWorkStealingPool(WorkStealingPool *this){
+    int i;
+    pthread_mutex_lock(&this->lock);
+    this->stop = 1;
+    pthread_cond_broadcast(&this->work);
+    pthread_mutex_unlock(&this->lock);
+    for(i = 0; i < this->num_created; i++)
+        pthread_join(this->threads[i], NULL);
+    for(i = 0; i < this->num_threads; i++)
+        destroyWorkDeque(&this->deques[i]);
+    destroyStack(&this->injected);
+    pthread_mutex_destroy(&this->lock);
+    pthread_cond_destroy(&this->work);
+    pthread_cond_destroy(&this->done);
+    free(this->deques);
+    free(this->threads);
+    free(this);
+}
+
+/**
+ *
+ * @details From a task the element goes on the worker's own deque, from
+ * any other thread on the injected stack, waking the workers.
+ * @param this
+ * @param d
+ */
+void _spawn_work_stealing_pool(WorkStealingPool *this, void *d){
+    atomic_fetch_add_explicit(&this->pending, 1, memory_order_acq_rel);
+    if(current_pool == this && this->deques[current_worker].push(&this->deques[current_worker], d))
+        return;
+    pthread_mutex_lock(&this->lock);
+    this->injected.push(&this->injected, d, NULL);
+    pthread_cond_broadcast(&this->work);
+    pthread_mutex_unlock(&this->lock);
+}
+
+/**
+ *
+ * @details Returns once every spawned task and the tasks they spawned are
+ * done. Not to be called from a task.
+ * @param this
+ */
+void _wait_work_stealing_pool(WorkStealingPool *this){
+    pthread_mutex_lock(&this->lock);
+    while(atomic_load_explicit(&this->pending, memory_order_acquire) > 0)
+        pthread_cond_wait(&this->done, &this->lock);
+    pthread_mutex_unlock(&this->lock);
+}
+
+/**
+ *
+ * @param this
+ * @return
+ */
+int _get_num_threads_work_stealing_pool(WorkStealingPool *this){
+    return this->num_created;
+}
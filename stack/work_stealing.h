@@ -0,0 +1,96 @@
+#ifndef WORK_STEALING_H
+#define WORK_STEALING_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "stack.h"
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+#define WORK_DEQUE_CAPACITY 256
+
+typedef struct WorkDequeArray WorkDequeArray;
+typedef struct WorkDeque WorkDeque;
+typedef struct WorkStealingPool WorkStealingPool;
+
+/**
+ * Circular array of a deque, replaced by one twice as big when full. The
+ * old one is kept until destroyWorkDeque since a thief may still read it.
+ */
+struct WorkDequeArray{
+    WorkDequeArray* retired;//previous array
+    long capacity;
+    _Atomic(void*) slots[];
+};
+
+/**
+ * Chase-Lev deque: the owner pushes and pops at bottom, thieves steal at
+ * top. Only a pop/steal race on the last element needs a CAS.
+ */
+typedef struct PrivateDataWorkDeque{
+    _Alignas(64) atomic_long top;
+    _Alignas(64) atomic_long bottom;
+    _Alignas(64) _Atomic(WorkDequeArray*) array;
+}PrivateDataWorkDeque;
+
+struct WorkDeque{
+    void* const private;
+    unsigned int (*const get_size)(WorkDeque *this);
+    int (*const push)(WorkDeque *this, void* d);
+    int (*const pop)(WorkDeque *this, void** d);
+    int (*const steal)(WorkDeque *this, void** d);
+};
+
+/**
+ * Workers with a deque each: a task spawned by a worker goes on its own
+ * deque, an idle worker steals from the others; tasks spawned from outside
+ * go through a locked Stack. run is called with each spawned task.
+ */
+struct WorkStealingPool{
+    int num_threads;//deques
+    int num_created;//threads running
+    pthread_t *threads;
+    WorkDeque *deques;
+    Stack injected;
+    pthread_mutex_t lock;
+    pthread_cond_t work;
+    pthread_cond_t done;
+    atomic_long pending;
+    atomic_long num_steals;
+    atomic_int num_started;
+    int stop;
+    void (*task)(WorkStealingPool *pool, void *arg, void *d);
+    void *arg;
+    void (*spawn)(WorkStealingPool *this, void *d);
+    void (*wait)(WorkStealingPool *this);
+    int (*get_num_threads)(WorkStealingPool *this);
+};
+
+WorkDeque newWorkDeque(unsigned int capacity);
+void destroyWorkDeque(WorkDeque *this);
+static unsigned int _get_size_work_deque(WorkDeque *this);
+static int _push_work_deque(WorkDeque *this, void* d);
+static int _pop_work_deque(WorkDeque *this, void** d);
+static int _steal_work_deque(WorkDeque *this, void** d);
+
+/**
+ *
+ * @param num_threads
+ * @param task called for every spawned d, may spawn more
+ * @param arg passed to task
+ * @return
+ */
+WorkStealingPool *newWorkStealingPool(int num_threads, void (*task)(WorkStealingPool *pool, void *arg, void *d), void *arg);
+void destroyWorkStealingPool(WorkStealingPool *this);
+static void _spawn_work_stealing_pool(WorkStealingPool *this, void *d);
+static void _wait_work_stealing_pool(WorkStealingPool *this);
+static int _get_num_threads_work_stealing_pool(WorkStealingPool *this);
+
+#ifdef	__cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,163 @@
+/*
+ * File:   work_stealing_main.c
+ * Author: regoeco
+ *
+ * Benchmark of the work-stealing pool against threads sharing one Stack
+ * behind a mutex, on the traversal of an implicit binary tree where every
+ * node is a task that spawns its two children.
+ *
+ * Usage: work_stealing_main [depth] [threads] [work]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include "work_stealing.h"
+
+int depth = 20;
+int num_threads = 4;
+int work = 64;
+unsigned long num_nodes;
+atomic_ulong checksum;
+
+/**
+ *
+ * @param node
+ * @return some work on the node
+ */
+unsigned long visit(unsigned long node){
+    unsigned long x = node;
+    int i;
+    for(i = 0; i < work; i++){
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+    }
+    return x;
+}
+
+double seconds(){
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec*1e-9;
+}
+
+//SERIAL
+unsigned long run_serial(){
+    Stack stack = newChunkedStack(STACK_CHUNK_SIZE);
+    unsigned long sum = 0;
+    stack.push(&stack, (void*)(uintptr_t)1, NULL);
+    while(stack.get_size(&stack) > 0){
+        unsigned long node = (uintptr_t)stack.peek(&stack);
+        stack.pop(&stack, NULL);
+        sum += visit(node);
+        if(2*node < num_nodes){
+            stack.push(&stack, (void*)(uintptr_t)(2*node), NULL);
+            stack.push(&stack, (void*)(uintptr_t)(2*node + 1), NULL);
+        }
+    }
+    destroyStack(&stack);
+    return sum;
+}
+
+//MUTEX STACK
+Stack *shared;
+pthread_mutex_t shared_lock = PTHREAD_MUTEX_INITIALIZER;
+atomic_long shared_pending;
+
+void* locked_worker(void* arg){
+    unsigned long sum = 0;
+    for(;;){
+        unsigned long node = 0;
+        pthread_mutex_lock(&shared_lock);
+        if(shared->get_size(shared) > 0){
+            node = (uintptr_t)shared->peek(shared);
+            shared->pop(shared, NULL);
+        }
+        pthread_mutex_unlock(&shared_lock);
+        if(node == 0){
+            if(atomic_load(&shared_pending) == 0)
+                break;
+            sched_yield();
+            continue;
+        }
+        sum += visit(node);
+        pthread_mutex_lock(&shared_lock);
+        if(2*node < num_nodes){
+            shared->push(shared, (void*)(uintptr_t)(2*node), NULL);
+            shared->push(shared, (void*)(uintptr_t)(2*node + 1), NULL);
+            atomic_fetch_add(&shared_pending, 2);
+        }
+        pthread_mutex_unlock(&shared_lock);
+        atomic_fetch_sub(&shared_pending, 1);
+    }
+    atomic_fetch_add(&checksum, sum);
+    return NULL;
+}
+
+unsigned long run_locked(){
+    pthread_t threads[64];
+    Stack stack = newChunkedStack(STACK_CHUNK_SIZE);
+    int i;
+    shared = &stack;
+    atomic_store(&checksum, 0);
+    stack.push(&stack, (void*)(uintptr_t)1, NULL);
+    atomic_store(&shared_pending, 1);
+    for(i = 0; i < num_threads; i++)
+        pthread_create(&threads[i], NULL, locked_worker, NULL);
+    for(i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+    destroyStack(&stack);
+    return atomic_load(&checksum);
+}
+
+//WORK STEALING
+void stealing_task(WorkStealingPool *pool, void *arg, void *d){
+    unsigned long node = (uintptr_t)d;
+    atomic_fetch_add_explicit(&checksum, visit(node), memory_order_relaxed);
+    if(2*node < num_nodes){
+        pool->spawn(pool, (void*)(uintptr_t)(2*node));
+        pool->spawn(pool, (void*)(uintptr_t)(2*node + 1));
+    }
+}
+
+unsigned long run_stealing(WorkStealingPool *pool){
+    atomic_store(&checksum, 0);
+    pool->spawn(pool, (void*)(uintptr_t)1);
+    pool->wait(pool);
+    return atomic_load(&checksum);
+}
+
+//MAIN
+int main(int argc, char** argv)
+{
+    unsigned long serial, locked, stealing;
+    double t;
+    if(argc > 1)
+        depth = atoi(argv[1]);
+    if(argc > 2)
+        num_threads = atoi(argv[2]);
+    if(argc > 3)
+        work = atoi(argv[3]);
+    if(num_threads < 1 || num_threads > 64)
+        num_threads = 4;
+    num_nodes = 1UL << depth;
+    printf("Nodes:%lu Threads:%d Work:%d\n", num_nodes - 1, num_threads, work);
+
+    t = seconds();
+    serial = run_serial();
+    printf("serial chunked stack   %8.3f s\n", seconds() - t);
+
+    t = seconds();
+    locked = run_locked();
+    printf("mutex shared stack     %8.3f s%s\n", seconds() - t, locked == serial ? "" : "  CHECKSUM MISMATCH");
+
+    WorkStealingPool *pool = newWorkStealingPool(num_threads, stealing_task, NULL);
+    t = seconds();
+    stealing = run_stealing(pool);
+    printf("work stealing          %8.3f s%s steals:%ld\n", seconds() - t, stealing == serial ? "" : "  CHECKSUM MISMATCH",
+           atomic_load(&pool->num_steals));
+    destroyWorkStealingPool(pool);
+
+    return locked == serial && stealing == serial ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,89 @@
+//
+// Created by regoeco on 18/01/17.
+//
+#include <cstdio>
+#include <cstdlib>
+#include "../stack/stack.hpp"
+#include "../queue/queue.hpp"
+
+/**
+ * usage: facade_test
+ *
+ * Builds ds::stack and ds::queue against the C storage they wrap, pushing
+ * across chunk boundaries and buffer growth, and checks every value comes
+ * back in order. Exits with failure on any mismatch.
+ */
+struct Point{
+    int x;
+    double y;
+};
+
+static int errors = 0;
+
+static void check(bool ok, const char* what){
+    if(!ok){
+        std::fprintf(stderr, "ERROR %s\n", what);
+        errors++;
+    }
+}
+
+static void test_stack(){
+    ds::stack<int> s(4);
+    int i, v;
+    check(s.empty(), "new stack is not empty");
+    for(i = 0; i < 1000; i++)
+        check(s.push(i), "stack push failed");
+    check(s.size() == 1000, "stack size after push");
+    check(s.top() == 999, "stack top");
+    for(i = 999; i >= 500; i--)
+        check(s.pop(v) && v == i, "stack pop order");
+    for(i = 500; i < 600; i++)
+        s.push(i);
+    for(i = 599; i >= 0; i--)
+        check(s.pop(v) && v == i, "stack pop order after refill");
+    check(!s.pop(v) && s.empty(), "pop of an empty stack");
+    s.push(1);
+    s.clear();
+    check(s.empty() && s.c_stack() != nullptr, "stack clear");
+
+    ds::stack<Point> p;
+    Point a = { 3, 0.5 }, b;
+    p.push(a);
+    check(p.pop(b) && b.x == 3 && b.y == 0.5, "stack of structs");
+}
+
+static void test_queue(){
+    ds::queue<int> q(2);
+    int i, v, next = 0;
+    check(q.empty(), "new queue is not empty");
+    //head moves before each growth so the buffer wraps
+    for(i = 0; i < 1000; i++){
+        check(q.push(i), "queue push failed");
+        if(i%3 == 0)
+            check(q.pop(v) && v == next++, "queue pop order");
+    }
+    check(q.size() == (unsigned int)(1000 - next), "queue size");
+    check(q.front() == next, "queue front");
+    while(q.pop(v))
+        check(v == next++, "queue pop order after growth");
+    check(next == 1000 && q.empty(), "queue drained");
+    q.push(1);
+    q.clear();
+    check(q.empty() && q.c_queue() != nullptr, "queue clear");
+
+    ds::queue<Point> p;
+    Point a = { 4, 1.5 }, b;
+    p.push(a);
+    check(p.pop(b) && b.x == 4 && b.y == 1.5, "queue of structs");
+}
+
+int main(){
+    test_stack();
+    test_queue();
+    if(errors > 0){
+        std::fprintf(stderr, "%d ERRORS\n", errors);
+        return EXIT_FAILURE;
+    }
+    std::printf("OK\n");
+    return EXIT_SUCCESS;
+}
@@ -6,10 +6,22 @@
  * @return BinaryTree
  */
 BinaryTree newBinaryTree(){
+    return newPooledBinaryTree(NULL);
+}
+
+/**
+ *
+ * @details Nodes come from pool, which must outlive the tree. A pool with
+ * nodes smaller than a BinaryTreeADT is ignored.
+ * @param pool NULL for malloc
+ * @return BinaryTree
+ */
+BinaryTree newPooledBinaryTree(NodePool *pool){
     struct PrivateDataBinaryTree *p = malloc(sizeof(struct PrivateDataBinaryTree));
     p->binary_tree_adt = NULL;
     p->depth = 0;
     p->num_elements = 0;
+    p->pool = acceptNodePool(pool, sizeof(ELEMENT_BINARY_TREE));
 
     BinaryTree this = {
             .empty = _empty_binary_tree,
@@ -48,7 +60,7 @@ int _insert_binary_tree(BinaryTree *this, const void* data_to_insert, void(*cons
     if( private->binary_tree_adt == NULL)
     {
         BinaryTreeADT new;
-        new = (BinaryTreeADT)malloc(sizeof(ELEMENT_BINARY_TREE));
+        new = (BinaryTreeADT)allocNode(private->pool, sizeof(ELEMENT_BINARY_TREE));
         if(callback_insert != NULL)
             callback_insert(data_to_insert);
         new->father = NULL;
@@ -69,7 +81,7 @@ int _insert_binary_tree(BinaryTree *this, const void* data_to_insert, void(*cons
                 if( tmp->left_leaf != NULL){
                     tmp = (BinaryTreeADT)tmp->left_leaf;
                 }else{
-                    BinaryTreeADT new = (BinaryTreeADT)malloc(sizeof(ELEMENT_BINARY_TREE));
+                    BinaryTreeADT new = (BinaryTreeADT)allocNode(private->pool, sizeof(ELEMENT_BINARY_TREE));
                     if(callback_insert != NULL)
                         callback_insert(data_to_insert);
                     new->data = (void*)data_to_insert;
@@ -91,7 +103,7 @@ int _insert_binary_tree(BinaryTree *this, const void* data_to_insert, void(*cons
                 if( tmp->right_leaf != NULL){
                     tmp = tmp->right_leaf;
                 }else{
-                    BinaryTreeADT new = (BinaryTreeADT)malloc(sizeof(ELEMENT_BINARY_TREE));
+                    BinaryTreeADT new = (BinaryTreeADT)allocNode(private->pool, sizeof(ELEMENT_BINARY_TREE));
                     if(callback_insert != NULL)
                         callback_insert(data_to_insert);
                     new->data = (void*)data_to_insert;
@@ -140,379 +152,428 @@ int _insert_multiple_binary_tree(BinaryTree *this, void(*const callback_insert)(
     return r;
 }
 
+//NID: NODO RAIZ, NODO IZQUIERDO, NODO DERECHO
 /**
  *
- * @param this_binary_tree
+ * @param this
  * @return
  */
-struct ChainingGet _get_binary_tree(const BinaryTree *this){
-    //DATA STACK
-    typedef struct{ BinaryTreeADT ptb; }struct_ptb;
-    static struct PrivateDataBinaryTree *private;
-
-    private = (struct PrivateDataBinaryTree*)this->private;
-
-    struct PreorderGet preorder() {
-        //NID: NODO RAIZ, NODO IZQUIERDO, NODO DERECHO
-        void** left(void){
-            if(private->num_elements > 0) {
-                int i = 0;
-                void** data = calloc(sizeof(void*), private->num_elements);
-                 Stack stack = newStack();
-                stack.push(&stack, private->binary_tree_adt, NULL);
-                while (stack.get_size(&stack) > 0) {
-                    BinaryTreeADT pbinary_tree_adt1 = (BinaryTreeADT)stack.peek(&stack);
+static void** _get_preorder_left_binary_tree(const BinaryTree *this){
+    struct PrivateDataBinaryTree *private = (struct PrivateDataBinaryTree*)this->private;
+    if(private->num_elements > 0) {
+        int i = 0;
+        void** data = calloc(sizeof(void*), private->num_elements);
+         Stack stack = newChunkedStack(STACK_CHUNK_SIZE);
+        stack.push(&stack, private->binary_tree_adt, NULL);
+        while (stack.get_size(&stack) > 0) {
+            BinaryTreeADT pbinary_tree_adt1 = (BinaryTreeADT)stack.peek(&stack);
+            stack.pop(&stack, NULL);
+            data[i++] = pbinary_tree_adt1->data;
+            if (pbinary_tree_adt1->right_leaf != NULL) {
+                stack.push(&stack, (void *) pbinary_tree_adt1->right_leaf, NULL);
+            }
+            if (pbinary_tree_adt1->left_leaf != NULL) {
+                stack.push(&stack, (void *) pbinary_tree_adt1->left_leaf, NULL);
+            }
+        }
+        destroyStack(&stack);
+        return data;
+    }else
+        return NULL;
+}
+
+//DIN: NODO DERECHO, NODOD IZQUIERDO, NODOD RAIZ
+/**
+ *
+ * @param this
+ * @return
+ */
+static void** _get_preorder_right_binary_tree(const BinaryTree *this){
+    struct PrivateDataBinaryTree *private = (struct PrivateDataBinaryTree*)this->private;
+    if (private->num_elements > 0) {
+        int i = 0;
+        void** data = calloc(sizeof(void*), private->num_elements);
+        BinaryTreeADT currentNode = NULL;
+         Stack stack = newChunkedStack(STACK_CHUNK_SIZE);
+        stack.push(&stack, private->binary_tree_adt, NULL);
+        BinaryTreeADT prev = NULL;
+
+        while (stack.get_size(&stack) > 0) {
+            currentNode = (BinaryTreeADT) stack.peek(&stack);
+            /* case 1. We are nmoving down the tree. */
+            if (prev == NULL || prev->left_leaf == currentNode || prev->right_leaf == currentNode) {
+                if (currentNode->right_leaf)
+                    stack.push(&stack, currentNode->right_leaf, NULL);
+                else if (currentNode->left_leaf)
+                    stack.push(&stack, currentNode->left_leaf, NULL);
+                else {
+                    /* If node is leaf node */
+                    data[i++] = currentNode->data;
                     stack.pop(&stack, NULL);
-                    data[i++] = pbinary_tree_adt1->data;
-                    if (pbinary_tree_adt1->right_leaf != NULL) {
-                        stack.push(&stack, (void *) pbinary_tree_adt1->right_leaf, NULL);
-                    }
-                    if (pbinary_tree_adt1->left_leaf != NULL) {
-                        stack.push(&stack, (void *) pbinary_tree_adt1->left_leaf, NULL);
-                    }
                 }
-                destroyStack(&stack);
-                return data;
-            }else
-                return NULL;
+            }
+            /* case 2. We are moving up the tree from left child */
+            if (currentNode->right_leaf == prev) {
+                if (currentNode->left_leaf)
+                    stack.push(&stack, currentNode->left_leaf, NULL);
+                else {
+                    data[i++] = currentNode->data;
+                    stack.pop(&stack, NULL);
+                }
+            }
+            /* case 3. We are moving up the tree from right child */
+            if (currentNode->left_leaf == prev) {
+                data[i++] = currentNode->data;
+                stack.pop(&stack, NULL);
+            }
+            prev = currentNode;
         }
 
-        //DIN: NODO DERECHO, NODOD IZQUIERDO, NODOD RAIZ
-        void** right(void) {
-            if (private->num_elements > 0) {
-                int i = 0;
-                void** data = calloc(sizeof(void*), private->num_elements);
-                BinaryTreeADT currentNode = NULL;
-                 Stack stack = newStack();
-                stack.push(&stack, private->binary_tree_adt, NULL);
-                BinaryTreeADT prev = NULL;
-
-                while (stack.get_size(&stack) > 0) {
-                    currentNode = (BinaryTreeADT) stack.peek(&stack);
-                    /* case 1. We are nmoving down the tree. */
-                    if (prev == NULL || prev->left_leaf == currentNode || prev->right_leaf == currentNode) {
-                        if (currentNode->right_leaf)
-                            stack.push(&stack, currentNode->right_leaf, NULL);
-                        else if (currentNode->left_leaf)
-                            stack.push(&stack, currentNode->left_leaf, NULL);
-                        else {
-                            /* If node is leaf node */
-                            data[i++] = currentNode->data;
-                            stack.pop(&stack, NULL);
-                        }
-                    }
-                    /* case 2. We are moving up the tree from left child */
-                    if (currentNode->right_leaf == prev) {
-                        if (currentNode->left_leaf)
-                            stack.push(&stack, currentNode->left_leaf, NULL);
-                        else {
-                            data[i++] = currentNode->data;
-                            stack.pop(&stack, NULL);
-                        }
-                    }
-                    /* case 3. We are moving up the tree from right child */
-                    if (currentNode->left_leaf == prev) {
-                        data[i++] = currentNode->data;
-                        stack.pop(&stack, NULL);
-                    }
-                    prev = currentNode;
-                }
+        destroyStack(&stack);
+        return data;
+    }else return NULL;
+}
 
-                destroyStack(&stack);
-                return data;
-            }else return NULL;
+//IND: NODO IZQUIERDO, NODO RAIZ, NODO DERECHO
+/**
+ *
+ * @param this
+ * @return
+ */
+static void** _get_inorder_asc_binary_tree(const BinaryTree *this){
+    struct PrivateDataBinaryTree *private = (struct PrivateDataBinaryTree*)this->private;
+    if(private->num_elements > 0){
+        int i = 0;
+        void** datas = calloc(sizeof(void*), private->num_elements);
+        Stack stack = newChunkedStack(STACK_CHUNK_SIZE);
+        BinaryTreeADT pbinary_tree_adt1 = private->binary_tree_adt;
+        while(stack.get_size(&stack) > 0 || pbinary_tree_adt1 ){
+            if(pbinary_tree_adt1){
+                stack.push(&stack, pbinary_tree_adt1, NULL);
+                pbinary_tree_adt1 = (BinaryTreeADT)pbinary_tree_adt1->left_leaf;
+            }
+            else {
+                pbinary_tree_adt1 = (BinaryTreeADT)stack.peek(&stack);
+                stack.pop(&stack, NULL);
+                datas[i++] = pbinary_tree_adt1->data;
+                pbinary_tree_adt1 =(BinaryTreeADT) pbinary_tree_adt1->right_leaf;
+            }
         }
-        struct PreorderGet preorder = {
-            .left = left,
-            .right = right
-        };
-        return preorder;
-    }
+        destroyStack(&stack);
+        return datas;
+    }return NULL;
+}
 
-    struct InorderGet inorder() {
-
-        //IND: NODO IZQUIERDO, NODO RAIZ, NODO DERECHO
-        void** asc(void){
-            if(private->num_elements > 0){
-                int i = 0;
-                void** datas = calloc(sizeof(void*), private->num_elements);
-                Stack stack = newStack();
-                BinaryTreeADT pbinary_tree_adt1 = private->binary_tree_adt;
-                while(stack.get_size(&stack) > 0 || pbinary_tree_adt1 ){
-                    if(pbinary_tree_adt1){
-                        stack.push(&stack, pbinary_tree_adt1, NULL);
-                        pbinary_tree_adt1 = (BinaryTreeADT)pbinary_tree_adt1->left_leaf;
-                    }
-                    else {
-                        pbinary_tree_adt1 = (BinaryTreeADT)stack.peek(&stack);
-                        stack.pop(&stack, NULL);
-                        datas[i++] = pbinary_tree_adt1->data;
-                        pbinary_tree_adt1 =(BinaryTreeADT) pbinary_tree_adt1->right_leaf;
-                    }
-                }
-                destroyStack(&stack);
-                return datas;
-            }return NULL;
+//DNI: NODO DERECHO, NODO RAIZ, NODO IZQUIERDO
+/**
+ *
+ * @param this
+ * @return
+ */
+static void** _get_inorder_des_binary_tree(const BinaryTree *this){
+    struct PrivateDataBinaryTree *private = (struct PrivateDataBinaryTree*)this->private;
+    if(private->num_elements > 0){
+        int i = 0;
+        void **data = calloc(sizeof(void*), private->num_elements);
+        Stack stack = newChunkedStack(STACK_CHUNK_SIZE);
+        BinaryTreeADT pbinary_tree_adt1 = private->binary_tree_adt;
+        while(stack.get_size(&stack) > 0 || pbinary_tree_adt1 ){
+            if(pbinary_tree_adt1){
+                stack.push(&stack, pbinary_tree_adt1, NULL);
+                pbinary_tree_adt1 = (BinaryTreeADT)pbinary_tree_adt1->right_leaf;
+            }
+            else {
+                pbinary_tree_adt1 = (BinaryTreeADT)stack.peek(&stack);
+                stack.pop(&stack, NULL);
+                data[i++] = pbinary_tree_adt1->data;
+                pbinary_tree_adt1 =(BinaryTreeADT) pbinary_tree_adt1->left_leaf;
+            }
         }
+        destroyStack(&stack);
+        return data;
+    }else
+        return NULL;
+}
 
-        //DNI: NODO DERECHO, NODO RAIZ, NODO IZQUIERDO
-        void** des(void){
-            if(private->num_elements > 0){
-                int i = 0;
-                void **data = calloc(sizeof(void*), private->num_elements);
-                Stack stack = newStack();
-                BinaryTreeADT pbinary_tree_adt1 = private->binary_tree_adt;
-                while(stack.get_size(&stack) > 0 || pbinary_tree_adt1 ){
-                    if(pbinary_tree_adt1){
-                        stack.push(&stack, pbinary_tree_adt1, NULL);
-                        pbinary_tree_adt1 = (BinaryTreeADT)pbinary_tree_adt1->right_leaf;
-                    }
-                    else {
-                        pbinary_tree_adt1 = (BinaryTreeADT)stack.peek(&stack);
-                        stack.pop(&stack, NULL);
-                        data[i++] = pbinary_tree_adt1->data;
-                        pbinary_tree_adt1 =(BinaryTreeADT) pbinary_tree_adt1->left_leaf;
-                    }
+//IDN: NODO IZQUIERDO, NODO DERECHO, NODO RAIZ
+/**
+ *
+ * @param this
+ * @return
+ */
+static void** _get_postorder_left_binary_tree(const BinaryTree *this){
+    struct PrivateDataBinaryTree *private = (struct PrivateDataBinaryTree*)this->private;
+    if(private->num_elements > 0) {
+        int i = 0;
+        void** data = calloc(sizeof(void*), private->num_elements);
+        BinaryTreeADT currentNode = NULL;
+        Stack stack = newChunkedStack(STACK_CHUNK_SIZE);
+        stack.push(&stack, private->binary_tree_adt, NULL);
+        BinaryTreeADT prev = NULL;
+
+        while (stack.get_size(&stack) > 0) {
+            currentNode = (BinaryTreeADT) stack.peek(&stack);
+            /* case 1. We are nmoving down the tree. */
+            if (prev == NULL || prev->left_leaf == currentNode || prev->right_leaf == currentNode) {
+                if (currentNode->left_leaf)
+                    stack.push(&stack, currentNode->left_leaf, NULL);
+                else if (currentNode->right_leaf)
+                    stack.push(&stack, currentNode->right_leaf, NULL);
+                else {
+                    /* If node is leaf node */
+                    data[i++] = currentNode->data;
+                    stack.pop(&stack, NULL);
                 }
-                destroyStack(&stack);
-                return data;
-            }else
-                return NULL;
-        }
-
-        struct InorderGet inorder = {
-            .asc = asc,
-            .des = des
-        };
-        return inorder;
-    }
-
-    struct PostorderGet postorder() {
-
-        //IDN: NODO IZQUIERDO, NODO DERECHO, NODO RAIZ
-        void** left(void){
-            if(private->num_elements > 0) {
-                int i = 0;
-                void** data = calloc(sizeof(void*), private->num_elements);
-                BinaryTreeADT currentNode = NULL;
-                Stack stack = newStack();
-                stack.push(&stack, private->binary_tree_adt, NULL);
-                BinaryTreeADT prev = NULL;
-
-                while (stack.get_size(&stack) > 0) {
-                    currentNode = (BinaryTreeADT) stack.peek(&stack);
-                    /* case 1. We are nmoving down the tree. */
-                    if (prev == NULL || prev->left_leaf == currentNode || prev->right_leaf == currentNode) {
-                        if (currentNode->left_leaf)
-                            stack.push(&stack, currentNode->left_leaf, NULL);
-                        else if (currentNode->right_leaf)
-                            stack.push(&stack, currentNode->right_leaf, NULL);
-                        else {
-                            /* If node is leaf node */
-                            data[i++] = currentNode->data;
-                            stack.pop(&stack, NULL);
-                        }
-                    }
-                    /* case 2. We are moving up the tree from left child */
-                    if (currentNode->left_leaf == prev) {
-                        if (currentNode->right_leaf)
-                            stack.push(&stack, currentNode->right_leaf, NULL);
-                        else {
-                            data[i++] = currentNode->data;
-                            stack.pop(&stack, NULL);
-                        }
-                    }
-                    /* case 3. We are moving up the tree from right child */
-                    if (currentNode->right_leaf == prev) {
-                        data[i++] = currentNode->data;
-                        stack.pop(&stack, NULL);
-                    }
-                    prev = currentNode;
+            }
+            /* case 2. We are moving up the tree from left child */
+            if (currentNode->left_leaf == prev) {
+                if (currentNode->right_leaf)
+                    stack.push(&stack, currentNode->right_leaf, NULL);
+                else {
+                    data[i++] = currentNode->data;
+                    stack.pop(&stack, NULL);
                 }
-                destroyStack(&stack);
-                return data;
-            }else
-                return NULL;
+            }
+            /* case 3. We are moving up the tree from right child */
+            if (currentNode->right_leaf == prev) {
+                data[i++] = currentNode->data;
+                stack.pop(&stack, NULL);
+            }
+            prev = currentNode;
         }
+        destroyStack(&stack);
+        return data;
+    }else
+        return NULL;
+}
 
-        //NDI: NODO RAIZ, NODO DERECHO, NODO IZQUIERDO
-        void** right(void){
-            if(private->num_elements > 0) {
-                int i = 0;
-                void** data = calloc(sizeof(void*), private->num_elements);
-                Stack stack = newStack();
-                stack.push(&stack, private->binary_tree_adt, NULL);
-                while (stack.get_size(&stack) > 0) {
-                    BinaryTreeADT pbinary_tree_adt1 = (BinaryTreeADT) stack.peek(&stack);
-                    stack.pop(&stack, NULL);
-                    data[i++] = pbinary_tree_adt1->data;
-                    if (pbinary_tree_adt1->left_leaf != NULL)
-                        stack.push(&stack, (void *) pbinary_tree_adt1->left_leaf, NULL);
-                    if (pbinary_tree_adt1->right_leaf != NULL)
-                        stack.push(&stack, (void *) pbinary_tree_adt1->right_leaf, NULL);
-                }
-                destroyStack(&stack);
-                return data;
-            }else
-                return NULL;
+//NDI: NODO RAIZ, NODO DERECHO, NODO IZQUIERDO
+/**
+ *
+ * @param this
+ * @return
+ */
+static void** _get_postorder_right_binary_tree(const BinaryTree *this){
+    struct PrivateDataBinaryTree *private = (struct PrivateDataBinaryTree*)this->private;
+    if(private->num_elements > 0) {
+        int i = 0;
+        void** data = calloc(sizeof(void*), private->num_elements);
+        Stack stack = newChunkedStack(STACK_CHUNK_SIZE);
+        stack.push(&stack, private->binary_tree_adt, NULL);
+        while (stack.get_size(&stack) > 0) {
+            BinaryTreeADT pbinary_tree_adt1 = (BinaryTreeADT) stack.peek(&stack);
+            stack.pop(&stack, NULL);
+            data[i++] = pbinary_tree_adt1->data;
+            if (pbinary_tree_adt1->left_leaf != NULL)
+                stack.push(&stack, (void *) pbinary_tree_adt1->left_leaf, NULL);
+            if (pbinary_tree_adt1->right_leaf != NULL)
+                stack.push(&stack, (void *) pbinary_tree_adt1->right_leaf, NULL);
         }
+        destroyStack(&stack);
+        return data;
+    }else
+        return NULL;
+}
 
-         struct PostorderGet postorder = {
-                .left = left,
-                .right = right
-        };
+static const struct PreorderGet preorder_get = {
+    .left = _get_preorder_left_binary_tree,
+    .right = _get_preorder_right_binary_tree
+};
 
-        return postorder;
-    }
+/**
+ *
+ * @return
+ */
+static struct PreorderGet _get_preorder_binary_tree(void){
+    return preorder_get;
+}
 
+static const struct InorderGet inorder_get = {
+    .asc = _get_inorder_asc_binary_tree,
+    .des = _get_inorder_des_binary_tree
+};
 
-    struct ChainingGet methods  = {
-        .inorder = inorder,
-        .postorder = postorder,
-        .preorder = preorder
-    };
+/**
+ *
+ * @return
+ */
+static struct InorderGet _get_inorder_binary_tree(void){
+    return inorder_get;
+}
 
+static const struct PostorderGet postorder_get = {
+    .left = _get_postorder_left_binary_tree,
+    .right = _get_postorder_right_binary_tree
+};
 
-    return methods;
+/**
+ *
+ * @return
+ */
+static struct PostorderGet _get_postorder_binary_tree(void){
+    return postorder_get;
 }
 
+static const struct ChainingGet chaining_get = {
+    .inorder = _get_inorder_binary_tree,
+    .postorder = _get_postorder_binary_tree,
+    .preorder = _get_preorder_binary_tree
+};
+
 /**
  *
- * @param this_binary_tree
- * @param d
+ * @details The traversals take the tree as their argument, nothing is kept
+ * between calls: tree.get(&tree).inorder().asc(&tree).
+ * @param this
+ * @return
+ */
+struct ChainingGet _get_binary_tree(const BinaryTree *this){
+    return chaining_get;
+}
+
+/**
+ *
+ * @param this
+ * @param data_to_find
  * @param callback
  * @return
  */
-struct Find _find_binary_tree(BinaryTree *this, const void* data, int(*const callback)(const void* d1, const void* d2)){
-
-    static struct PrivateDataBinaryTree *private;
-    static int(*function)(const void* d1, const void* d2);
-    static const void* data_to_find;
-
-    private = (struct PrivateDataBinaryTree*)this->private;
-    function = callback;
-    data_to_find = data;
-
-    BinaryTreeADT get(void){
-        if(private->num_elements > 0){
-            BinaryTreeADT pb = private->binary_tree_adt;
-            int i = 0;
-            while(pb != NULL){
-                i = function(data_to_find, pb->data);
-                //mayor
-                if( i == 1 ){
-                    pb = pb->right_leaf;
-                }//menor
-                else if( i == -1 ){
-                    pb = pb->left_leaf;
-                }
-                //igual
-                else if( i == 0){
-                    return pb;
-                }
+static BinaryTreeADT _find_get_binary_tree(BinaryTree *this, const void* data_to_find, int(*const callback)(const void* d1, const void* d2)){
+    struct PrivateDataBinaryTree *private = (struct PrivateDataBinaryTree*)this->private;
+    if(private->num_elements > 0){
+        BinaryTreeADT pb = private->binary_tree_adt;
+        int i = 0;
+        while(pb != NULL){
+            i = callback(data_to_find, pb->data);
+            //mayor
+            if( i == 1 ){
+                pb = pb->right_leaf;
+            }//menor
+            else if( i == -1 ){
+                pb = pb->left_leaf;
+            }
+            //igual
+            else if( i == 0){
+                return pb;
             }
         }
-        return NULL;
     }
+    return NULL;
+}
 
-    int remove(){
-        if(private->num_elements>0){
-            BinaryTreeADT pb = private->binary_tree_adt;
-            int i = 0;
-            while(pb != NULL){
-                i = function(data_to_find, pb->data);
-                //mayor
-                if( i == 1 ){
-                    pb = pb->right_leaf;
-                }//menor
-                else if( i == -1 ){
-                    pb = pb->left_leaf;
-                }
-                    //igual
-                else if( i == 0){
-                    //ningun hijo
-                    if(pb->right_leaf != NULL && pb->left_leaf != NULL){
-                        //raiz
-                        if(pb->father == NULL){
-                            free(pb);
-                            private->binary_tree_adt = NULL;
-                            private->num_elements = private->depth = 0;
-                        }else{
-                            if(pb->father->left_leaf == pb){
-                                pb->father->left_leaf = NULL;
-                            }else if(pb->father->right_leaf == pb){
-                                pb->father->right_leaf = NULL;
-                            }
-                            free(pb);
-                            private->num_elements--;
-                        }
-                    }//hijo izquierdo
-                    else if(pb->right_leaf == NULL && pb->left_leaf != NULL){
-                        if(pb->father->left_leaf == pb){
-                            pb->father->left_leaf = pb->left_leaf;
-                        }else if(pb->father->right_leaf == pb){
-                            pb->father->right_leaf = pb->left_leaf;
-                        }
-                        free(pb);
-                        private->num_elements--;
-
-                    }//hijo derecho
-                    else if(pb->right_leaf != NULL && pb->left_leaf == NULL){
+/**
+ *
+ * @param this
+ * @param data_to_find
+ * @param callback
+ * @return
+ */
+static int _find_remove_binary_tree(BinaryTree *this, const void* data_to_find, int(*const callback)(const void* d1, const void* d2)){
+    struct PrivateDataBinaryTree *private = (struct PrivateDataBinaryTree*)this->private;
+    if(private->num_elements>0){
+        BinaryTreeADT pb = private->binary_tree_adt;
+        int i = 0;
+        while(pb != NULL){
+            i = callback(data_to_find, pb->data);
+            //mayor
+            if( i == 1 ){
+                pb = pb->right_leaf;
+            }//menor
+            else if( i == -1 ){
+                pb = pb->left_leaf;
+            }
+                //igual
+            else if( i == 0){
+                //ningun hijo
+                if(pb->right_leaf != NULL && pb->left_leaf != NULL){
+                    //raiz
+                    if(pb->father == NULL){
+                        releaseNode(private->pool, pb);
+                        private->binary_tree_adt = NULL;
+                        private->num_elements = private->depth = 0;
+                    }else{
                         if(pb->father->left_leaf == pb){
-                            pb->father->left_leaf = pb->right_leaf;
+                            pb->father->left_leaf = NULL;
                         }else if(pb->father->right_leaf == pb){
-                            pb->father->right_leaf = pb->right_leaf;
+                            pb->father->right_leaf = NULL;
                         }
-                        free(pb);
+                        releaseNode(private->pool, pb);
                         private->num_elements--;
-                    }//two children
-                    else if(pb->right_leaf == NULL && pb->left_leaf == NULL){
-                        BinaryTreeADT tmp_left = pb->left_leaf;
-                        BinaryTreeADT tmp_right = pb->right_leaf;
-                        while(tmp_left != NULL || tmp_right != NULL) {
-                            if (tmp_right->left_leaf != NULL) {
-                                tmp_right = tmp_right->left_leaf;
+                    }
+                }//hijo izquierdo
+                else if(pb->right_leaf == NULL && pb->left_leaf != NULL){
+                    if(pb->father->left_leaf == pb){
+                        pb->father->left_leaf = pb->left_leaf;
+                    }else if(pb->father->right_leaf == pb){
+                        pb->father->right_leaf = pb->left_leaf;
+                    }
+                    releaseNode(private->pool, pb);
+                    private->num_elements--;
+
+                }//hijo derecho
+                else if(pb->right_leaf != NULL && pb->left_leaf == NULL){
+                    if(pb->father->left_leaf == pb){
+                        pb->father->left_leaf = pb->right_leaf;
+                    }else if(pb->father->right_leaf == pb){
+                        pb->father->right_leaf = pb->right_leaf;
+                    }
+                    releaseNode(private->pool, pb);
+                    private->num_elements--;
+                }//two children
+                else if(pb->right_leaf == NULL && pb->left_leaf == NULL){
+                    BinaryTreeADT tmp_left = pb->left_leaf;
+                    BinaryTreeADT tmp_right = pb->right_leaf;
+                    while(tmp_left != NULL || tmp_right != NULL) {
+                        if (tmp_right->left_leaf != NULL) {
+                            tmp_right = tmp_right->left_leaf;
+                        } else {
+                            tmp_right->left_leaf = pb->left_leaf;
+                            if (pb->father != NULL) {
+                                pb->father->left_leaf = tmp_right;
                             } else {
-                                tmp_right->left_leaf = pb->left_leaf;
-                                if (pb->father != NULL) {
-                                    pb->father->left_leaf = tmp_right;
-                                } else {
-                                    private->binary_tree_adt = tmp_right;
-                                }
-                                free(pb);
-                                private->num_elements--;
-                                break;
+                                private->binary_tree_adt = tmp_right;
                             }
+                            releaseNode(private->pool, pb);
+                            private->num_elements--;
+                            break;
+                        }
 
-                            if (tmp_left->right_leaf != NULL) {
-                                tmp_left = tmp_left->right_leaf;
-                            } else {
-                                tmp_left->right_leaf = pb->right_leaf;
-                                if(pb->father != NULL){
-                                    pb->father->right_leaf = tmp_left;
-                                }else{
-                                    private->binary_tree_adt = tmp_right;
-                                }
-                                free(pb);
-                                private->num_elements--;
-                                break;
+                        if (tmp_left->right_leaf != NULL) {
+                            tmp_left = tmp_left->right_leaf;
+                        } else {
+                            tmp_left->right_leaf = pb->right_leaf;
+                            if(pb->father != NULL){
+                                pb->father->right_leaf = tmp_left;
+                            }else{
+                                private->binary_tree_adt = tmp_right;
                             }
+                            releaseNode(private->pool, pb);
+                            private->num_elements--;
+                            break;
                         }
                     }
-                    return 1;
                 }
+                return 1;
             }
-            return 0;
         }
-        else
-            return 0;
+        return 0;
     }
+    else
+        return 0;
+}
 
-    struct Find find = {
-        .get = get,
-        .remove = remove
-    };
+static const struct Find find = {
+    .get = _find_get_binary_tree,
+    .remove = _find_remove_binary_tree
+};
 
+/**
+ *
+ * @details tree.find(&tree).get(&tree, data, callback).
+ * @param this
+ * @return
+ */
+struct Find _find_binary_tree(BinaryTree *this){
     return find;
 }
 
@@ -522,286 +583,298 @@ struct Find _find_binary_tree(BinaryTree *this, const void* data, int(*const cal
  * @return
  */
 int _empty_binary_tree(BinaryTree *this){
-    Stack stack = newStack();
+    Stack stack = newChunkedStack(STACK_CHUNK_SIZE);
     struct PrivateDataBinaryTree *private = (struct PrivateDataBinaryTree*)this->private;
 
-    stack.push(&stack, private->binary_tree_adt, NULL);
-    BinaryTreeADT currentNode = NULL;
-    BinaryTreeADT prev = NULL;
+    if(private->binary_tree_adt != NULL)
+        stack.push(&stack, private->binary_tree_adt, NULL);
     while(stack.get_size(&stack) > 0){
-        currentNode = (BinaryTreeADT)stack.peek(&stack);
-        /* case 1. We are nmoving down the tree. */
-        if(prev == NULL || prev->left_leaf == currentNode || prev->right_leaf == currentNode){
-            if(currentNode->left_leaf)
-                stack.push(&stack, currentNode->left_leaf, NULL);
-            else if(currentNode->right_leaf)
-                stack.push(&stack, currentNode->right_leaf, NULL);
-            else {
-                /* If node is leaf node */
-                free(currentNode);
-                stack.pop(&stack, NULL);
-                private->num_elements--;
-            }
-        }
-        /* case 2. We are moving up the tree from left child */
-        if(currentNode->left_leaf == prev){
-            if(currentNode->right_leaf)
-                stack.push(&stack,currentNode->right_leaf, NULL);
-            else {
-                free(currentNode);
-                stack.pop(&stack, NULL);
-                private->num_elements--;
-            }
-        }
-        /* case 3. We are moving up the tree from right child */
-        if(currentNode->right_leaf == prev){
-            free(currentNode);
-            stack.pop(&stack, NULL);
-            private->num_elements--;
-        }
-        prev = currentNode;
+        BinaryTreeADT currentNode = (BinaryTreeADT)stack.peek(&stack);
+        stack.pop(&stack, NULL);
+        if(currentNode->left_leaf)
+            stack.push(&stack, currentNode->left_leaf, NULL);
+        if(currentNode->right_leaf)
+            stack.push(&stack, currentNode->right_leaf, NULL);
+        releaseNode(private->pool, currentNode);
+        private->num_elements--;
     }
+    private->binary_tree_adt = NULL;
+    private->depth = 0;
 
     destroyStack(&stack);
     return 1;
 }
 
+//NID: NODO RAIZ, NODO IZQUIERDO, NODO DERECHO
 /**
  *
- * @param this_binary_tree
+ * @param this
  * @param callback
  */
-struct ChainingPrint _print_binary_tree(const BinaryTree *this){
-
-    //DATA STACK
-    typedef struct{BinaryTreeADT ptb; }struct_ptb;
-    static struct PrivateDataBinaryTree *private;
-
-    private = (struct PrivateDataBinaryTree*)this->private;
+static void _print_preorder_left_binary_tree(const BinaryTree *this, void(*callback)(const void* d)){
+    struct PrivateDataBinaryTree *private = (struct PrivateDataBinaryTree*)this->private;
+    if(private->num_elements > 0) {
+        Stack stack = newChunkedStack(STACK_CHUNK_SIZE);
+        stack.push(&stack, private->binary_tree_adt, NULL);
+        while (stack.get_size(&stack) > 0) {
+            BinaryTreeADT pbinary_tree_adt1 = (BinaryTreeADT)stack.peek(&stack);
+            stack.pop(&stack, NULL);
+            if (callback != NULL)
+                callback(pbinary_tree_adt1->data);
 
-    struct PreorderPrint preorder(void(*callback)(const void* d)) {
-        static void(*f)(const void* d);
-        f = callback;
+            if (pbinary_tree_adt1->right_leaf != NULL) {
+                stack.push(&stack, (void *) pbinary_tree_adt1->right_leaf, NULL);
+            }
+            if (pbinary_tree_adt1->left_leaf != NULL) {
+                stack.push(&stack, (void *) pbinary_tree_adt1->left_leaf, NULL);
+            }
+        }
+        destroyStack(&stack);
+    }
+}
 
-        //NID: NODO RAIZ, NODO IZQUIERDO, NODO DERECHO
-        void left(void){
-            if(private->num_elements > 0) {
-                Stack stack = newStack();
-                stack.push(&stack, private->binary_tree_adt, NULL);
-                while (stack.get_size(&stack) > 0) {
-                    BinaryTreeADT pbinary_tree_adt1 = (BinaryTreeADT)stack.peek(&stack);
+//DIN: NODO DERECHO, NODOD IZQUIERDO, NODOD RAIZ
+/**
+ *
+ * @param this
+ * @param callback
+ */
+static void _print_preorder_right_binary_tree(const BinaryTree *this, void(*callback)(const void* d)){
+    struct PrivateDataBinaryTree *private = (struct PrivateDataBinaryTree*)this->private;
+    if (private->num_elements > 0) {
+        BinaryTreeADT currentNode = NULL;
+        Stack stack = newChunkedStack(STACK_CHUNK_SIZE);
+        stack.push(&stack, private->binary_tree_adt, NULL);
+        BinaryTreeADT prev = NULL;
+
+        while (stack.get_size(&stack) > 0) {
+            currentNode = (BinaryTreeADT) stack.peek(&stack);
+            /* case 1. We are nmoving down the tree. */
+            if (prev == NULL || prev->left_leaf == currentNode || prev->right_leaf == currentNode) {
+                if (currentNode->right_leaf)
+                    stack.push(&stack, currentNode->right_leaf, NULL);
+                else if (currentNode->left_leaf)
+                    stack.push(&stack, currentNode->left_leaf, NULL);
+                else {
+                    /* If node is leaf node */
+                    if (callback != NULL)
+                        callback(currentNode->data);
                     stack.pop(&stack, NULL);
-                    if (f != NULL)
-                        f(pbinary_tree_adt1->data);
-
-                    if (pbinary_tree_adt1->right_leaf != NULL) {
-                        stack.push(&stack, (void *) pbinary_tree_adt1->right_leaf, NULL);
-                    }
-                    if (pbinary_tree_adt1->left_leaf != NULL) {
-                        stack.push(&stack, (void *) pbinary_tree_adt1->left_leaf, NULL);
-                    }
                 }
-                destroyStack(&stack);
             }
+            /* case 2. We are moving up the tree from left child */
+            if (currentNode->right_leaf == prev) {
+                if (currentNode->left_leaf)
+                    stack.push(&stack, currentNode->left_leaf, NULL);
+                else {
+                    if (callback != NULL)
+                        callback(currentNode->data);
+                    stack.pop(&stack, NULL);
+                }
+            }
+            /* case 3. We are moving up the tree from right child */
+            if (currentNode->left_leaf == prev) {
+                if (callback != NULL)
+                    callback(currentNode->data);
+                stack.pop(&stack, NULL);
+            }
+            prev = currentNode;
         }
 
-        //DIN: NODO DERECHO, NODOD IZQUIERDO, NODOD RAIZ
-        void right(void) {
-            if (private->num_elements > 0) {
-                BinaryTreeADT currentNode = NULL;
-                Stack stack = newStack();
-                stack.push(&stack, private->binary_tree_adt, NULL);
-                BinaryTreeADT prev = NULL;
-
-                while (stack.get_size(&stack) > 0) {
-                    currentNode = (BinaryTreeADT) stack.peek(&stack);
-                    /* case 1. We are nmoving down the tree. */
-                    if (prev == NULL || prev->left_leaf == currentNode || prev->right_leaf == currentNode) {
-                        if (currentNode->right_leaf)
-                            stack.push(&stack, currentNode->right_leaf, NULL);
-                        else if (currentNode->left_leaf)
-                            stack.push(&stack, currentNode->left_leaf, NULL);
-                        else {
-                            /* If node is leaf node */
-                            if (f != NULL)
-                                f(currentNode->data);
-                            stack.pop(&stack, NULL);
-                        }
-                    }
-                    /* case 2. We are moving up the tree from left child */
-                    if (currentNode->right_leaf == prev) {
-                        if (currentNode->left_leaf)
-                            stack.push(&stack, currentNode->left_leaf, NULL);
-                        else {
-                            if (f != NULL)
-                                f(currentNode->data);
-                            stack.pop(&stack, NULL);
-                        }
-                    }
-                    /* case 3. We are moving up the tree from right child */
-                    if (currentNode->left_leaf == prev) {
-                        if (f != NULL)
-                            f(currentNode->data);
-                        stack.pop(&stack, NULL);
-                    }
-                    prev = currentNode;
-                }
+        destroyStack(&stack);
+    }
+}
 
-                destroyStack(&stack);
+//IND: NODO IZQUIERDO, NODO RAIZ, NODO DERECHO
+/**
+ *
+ * @param this
+ * @param callback
+ */
+static void _print_inorder_asc_binary_tree(const BinaryTree *this, void(*callback)(const void* d)){
+    struct PrivateDataBinaryTree *private = (struct PrivateDataBinaryTree*)this->private;
+    if(private->num_elements > 0){
+        Stack stack = newChunkedStack(STACK_CHUNK_SIZE);
+        BinaryTreeADT pbinary_tree_adt1 = private->binary_tree_adt;
+        while(stack.get_size(&stack) > 0 || pbinary_tree_adt1 ){
+            if(pbinary_tree_adt1){
+                stack.push(&stack, pbinary_tree_adt1, NULL);
+                pbinary_tree_adt1 = (BinaryTreeADT)pbinary_tree_adt1->left_leaf;
+            }
+            else {
+                pbinary_tree_adt1 = (BinaryTreeADT)stack.peek(&stack);
+                stack.pop(&stack, NULL);
+                if(callback != NULL)
+                    callback(pbinary_tree_adt1->data);
+                pbinary_tree_adt1 = (BinaryTreeADT)pbinary_tree_adt1->right_leaf;
             }
         }
-
-        struct PreorderPrint preorder  = {
-                .left = left,
-                .right = right
-        };
-        return preorder;
+        destroyStack(&stack);
     }
+}
 
-    struct InorderPrint inorder(void(*callback)(const void* d)) {
-        static void(*f)(const void* d);
-        f = callback;
-
-        //IND: NODO IZQUIERDO, NODO RAIZ, NODO DERECHO
-        void asc(void){
-            if(private->num_elements > 0){
-                Stack stack = newStack();
-                BinaryTreeADT pbinary_tree_adt1 = private->binary_tree_adt;
-                while(stack.get_size(&stack) > 0 || pbinary_tree_adt1 ){
-                    if(pbinary_tree_adt1){
-                        stack.push(&stack, pbinary_tree_adt1, NULL);
-                        pbinary_tree_adt1 = (BinaryTreeADT)pbinary_tree_adt1->left_leaf;
-                    }
-                    else {
-                        pbinary_tree_adt1 = (BinaryTreeADT)stack.peek(&stack);
-                        stack.pop(&stack, NULL);
-                        if(f != NULL)
-                            f(pbinary_tree_adt1->data);
-                        pbinary_tree_adt1 = (BinaryTreeADT)pbinary_tree_adt1->right_leaf;
-                    }
-                }
-                destroyStack(&stack);
+//DNI: NODO DERECHO, NODO RAIZ, NODO IZQUIERDO
+/**
+ *
+ * @param this
+ * @param callback
+ */
+static void _print_inorder_des_binary_tree(const BinaryTree *this, void(*callback)(const void* d)){
+    struct PrivateDataBinaryTree *private = (struct PrivateDataBinaryTree*)this->private;
+    if(private->num_elements > 0){
+        Stack stack = newChunkedStack(STACK_CHUNK_SIZE);
+        BinaryTreeADT pbinary_tree_adt1 = private->binary_tree_adt;
+        while(stack.get_size(&stack) > 0 || pbinary_tree_adt1 ){
+            if(pbinary_tree_adt1){
+                stack.push(&stack, pbinary_tree_adt1, NULL);
+                pbinary_tree_adt1 = (BinaryTreeADT)pbinary_tree_adt1->right_leaf;
+            }
+            else {
+                pbinary_tree_adt1 = (BinaryTreeADT)stack.peek(&stack);
+                stack.pop(&stack, NULL);
+                if(callback != NULL)
+                    callback(pbinary_tree_adt1->data);
+                pbinary_tree_adt1 =(BinaryTreeADT)pbinary_tree_adt1->left_leaf;
             }
         }
+        destroyStack(&stack);
+    }
+}
 
-        //DNI: NODO DERECHO, NODO RAIZ, NODO IZQUIERDO
-        void des(void){
-            if(private->num_elements > 0){
-                Stack stack = newStack();
-                BinaryTreeADT pbinary_tree_adt1 = private->binary_tree_adt;
-                while(stack.get_size(&stack) > 0 || pbinary_tree_adt1 ){
-                    if(pbinary_tree_adt1){
-                        stack.push(&stack, pbinary_tree_adt1, NULL);
-                        pbinary_tree_adt1 = (BinaryTreeADT)pbinary_tree_adt1->right_leaf;
-                    }
-                    else {
-                        pbinary_tree_adt1 = (BinaryTreeADT)stack.peek(&stack);
-                        stack.pop(&stack, NULL);
-                        if(f != NULL)
-                            f(pbinary_tree_adt1->data);
-                        pbinary_tree_adt1 =(BinaryTreeADT)pbinary_tree_adt1->left_leaf;
-                    }
+//IDN: NODO IZQUIERDO, NODO DERECHO, NODO RAIZ
+/**
+ *
+ * @param this
+ * @param callback
+ */
+static void _print_postorder_left_binary_tree(const BinaryTree *this, void(*callback)(const void* d)){
+    struct PrivateDataBinaryTree *private = (struct PrivateDataBinaryTree*)this->private;
+    if(private->num_elements > 0) {
+        BinaryTreeADT currentNode = NULL;
+        Stack stack = newChunkedStack(STACK_CHUNK_SIZE);
+        stack.push(&stack, private->binary_tree_adt, NULL);
+        BinaryTreeADT prev = NULL;
+
+        while (stack.get_size(&stack) > 0) {
+            currentNode = (BinaryTreeADT) stack.peek(&stack);
+            /* case 1. We are nmoving down the tree. */
+            if (prev == NULL || prev->left_leaf == currentNode || prev->right_leaf == currentNode) {
+                if (currentNode->left_leaf)
+                    stack.push(&stack, currentNode->left_leaf, NULL);
+                else if (currentNode->right_leaf)
+                    stack.push(&stack, currentNode->right_leaf, NULL);
+                else {
+                    /* If node is leaf node */
+                    if (callback != NULL)
+                        callback(currentNode->data);
+                    stack.pop(&stack, NULL);
                 }
-                destroyStack(&stack);
             }
+            /* case 2. We are moving up the tree from left child */
+            if (currentNode->left_leaf == prev) {
+                if (currentNode->right_leaf)
+                    stack.push(&stack, currentNode->right_leaf, NULL);
+                else {
+                    if (callback != NULL)
+                        callback(currentNode->data);
+                    stack.pop(&stack, NULL);
+                }
+            }
+            /* case 3. We are moving up the tree from right child */
+            if (currentNode->right_leaf == prev) {
+                if (callback != NULL)
+                    callback(currentNode->data);
+                stack.pop(&stack, NULL);
+            }
+            prev = currentNode;
         }
 
-        struct InorderPrint inorder = {
-            .asc = asc,
-            .des = des
-        };
-
-        return inorder;
+        destroyStack(&stack);
     }
+}
 
-    struct PostorderPrint postorder(void(*callback)(const void* d)) {
-        static void(*f)(const void* d);
-        f = callback;
-
-        //IDN: NODO IZQUIERDO, NODO DERECHO, NODO RAIZ
-        void left(void){
-            if(private->num_elements > 0) {
-                BinaryTreeADT currentNode = NULL;
-                Stack stack = newStack();
-                stack.push(&stack, private->binary_tree_adt, NULL);
-                BinaryTreeADT prev = NULL;
-
-                while (stack.get_size(&stack) > 0) {
-                    currentNode = (BinaryTreeADT) stack.peek(&stack);
-                    /* case 1. We are nmoving down the tree. */
-                    if (prev == NULL || prev->left_leaf == currentNode || prev->right_leaf == currentNode) {
-                        if (currentNode->left_leaf)
-                            stack.push(&stack, currentNode->left_leaf, NULL);
-                        else if (currentNode->right_leaf)
-                            stack.push(&stack, currentNode->right_leaf, NULL);
-                        else {
-                            /* If node is leaf node */
-                            if (f != NULL)
-                                f(currentNode->data);
-                            stack.pop(&stack, NULL);
-                        }
-                    }
-                    /* case 2. We are moving up the tree from left child */
-                    if (currentNode->left_leaf == prev) {
-                        if (currentNode->right_leaf)
-                            stack.push(&stack, currentNode->right_leaf, NULL);
-                        else {
-                            if (f != NULL)
-                                f(currentNode->data);
-                            stack.pop(&stack, NULL);
-                        }
-                    }
-                    /* case 3. We are moving up the tree from right child */
-                    if (currentNode->right_leaf == prev) {
-                        if (f != NULL)
-                            f(currentNode->data);
-                        stack.pop(&stack, NULL);
-                    }
-                    prev = currentNode;
-                }
+//NDI: NODO RAIZ, NODO DERECHO, NODO IZQUIERDO
+/**
+ *
+ * @param this
+ * @param callback
+ */
+static void _print_postorder_right_binary_tree(const BinaryTree *this, void(*callback)(const void* d)){
+    struct PrivateDataBinaryTree *private = (struct PrivateDataBinaryTree*)this->private;
+    if(private->num_elements > 0) {
+        Stack stack = newChunkedStack(STACK_CHUNK_SIZE);
+        stack.push(&stack, private->binary_tree_adt, NULL);
+        while (stack.get_size(&stack) > 0) {
+            BinaryTreeADT pbinary_tree_adt1 = (BinaryTreeADT) stack.peek(&stack);
+            stack.pop(&stack, NULL);
+
+            if (callback != NULL)
+                callback(pbinary_tree_adt1->data);
 
-                destroyStack(&stack);
+            if (pbinary_tree_adt1->left_leaf != NULL) {
+                stack.push(&stack, (void *) pbinary_tree_adt1->left_leaf, NULL);
+            }
+            if (pbinary_tree_adt1->right_leaf != NULL) {
+                stack.push(&stack, (void *) pbinary_tree_adt1->right_leaf, NULL);
             }
         }
+        destroyStack(&stack);
+    }
+}
 
-        //NDI: NODO RAIZ, NODO DERECHO, NODO IZQUIERDO
-        void right(void){
-            if(private->num_elements > 0) {
-                Stack stack = newStack();
-                stack.push(&stack, private->binary_tree_adt, NULL);
-                while (stack.get_size(&stack) > 0) {
-                    BinaryTreeADT pbinary_tree_adt1 = (BinaryTreeADT) stack.peek(&stack);
-                    stack.pop(&stack, NULL);
+static const struct PreorderPrint preorder_print = {
+    .left = _print_preorder_left_binary_tree,
+    .right = _print_preorder_right_binary_tree
+};
 
-                    if (f != NULL)
-                        f(pbinary_tree_adt1->data);
+/**
+ *
+ * @return
+ */
+static struct PreorderPrint _print_preorder_binary_tree(void){
+    return preorder_print;
+}
 
-                    if (pbinary_tree_adt1->left_leaf != NULL) {
-                        stack.push(&stack, (void *) pbinary_tree_adt1->left_leaf, NULL);
-                    }
-                    if (pbinary_tree_adt1->right_leaf != NULL) {
-                        stack.push(&stack, (void *) pbinary_tree_adt1->right_leaf, NULL);
-                    }
-                }
-                destroyStack(&stack);
-            }
-        }
+static const struct InorderPrint inorder_print = {
+    .asc = _print_inorder_asc_binary_tree,
+    .des = _print_inorder_des_binary_tree
+};
 
-        struct PostorderPrint postorder = {
-                .left = left,
-                .right= right
-        };
-        return postorder;
-    }
+/**
+ *
+ * @return
+ */
+static struct InorderPrint _print_inorder_binary_tree(void){
+    return inorder_print;
+}
 
-    struct ChainingPrint methods = {
-        .inorder = inorder,
-        .postorder = postorder,
-        .preorder = preorder
+static const struct PostorderPrint postorder_print = {
+    .left = _print_postorder_left_binary_tree,
+    .right = _print_postorder_right_binary_tree
+};
 
-    };
+/**
+ *
+ * @return
+ */
+static struct PostorderPrint _print_postorder_binary_tree(void){
+    return postorder_print;
+}
 
-    return methods;
+static const struct ChainingPrint chaining_print = {
+    .inorder = _print_inorder_binary_tree,
+    .postorder = _print_postorder_binary_tree,
+    .preorder = _print_preorder_binary_tree
+};
+
+/**
+ *
+ * @details tree.print(&tree).inorder().asc(&tree, callback).
+ * @param this
+ * @return
+ */
+struct ChainingPrint _print_binary_tree(const BinaryTree *this){
+    return chaining_print;
 }
 
 unsigned int _get_num_elements(BinaryTree *this){
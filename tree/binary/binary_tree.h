@@ -33,39 +33,41 @@
 #ifndef BINARY_TREE_H_
 #define BINARY_TREE_H_
 
+#include "../../pool/node_pool.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 typedef struct BinaryTree BinaryTree;
 typedef struct BinaryTreeADT* BinaryTreeADT, ELEMENT_BINARY_TREE;
 struct InorderPrint{
-    void (*const asc)(void);
-    void (*const des)(void);
+    void (*const asc)(const BinaryTree* this, void(*callback)(const void* data));
+    void (*const des)(const BinaryTree* this, void(*callback)(const void* data));
 };
 
 struct PreorderPrint{
-    void (*const left)(void);
-    void (*const right)(void);
+    void (*const left)(const BinaryTree* this, void(*callback)(const void* data));
+    void (*const right)(const BinaryTree* this, void(*callback)(const void* data));
 };
 
 struct PostorderPrint{
-    void (*const left)(void);
-    void (*const right)(void);
+    void (*const left)(const BinaryTree* this, void(*callback)(const void* data));
+    void (*const right)(const BinaryTree* this, void(*callback)(const void* data));
 };
 
 struct InorderGet{
-    void** (*const asc)(void);
-    void** (*const des)(void);
+    void** (*const asc)(const BinaryTree* this);
+    void** (*const des)(const BinaryTree* this);
 };
 
 struct PreorderGet{
-    void** (*const left)(void);
-    void** (*const right)(void);
+    void** (*const left)(const BinaryTree* this);
+    void** (*const right)(const BinaryTree* this);
 };
 
 struct PostorderGet{
-    void** (*const left)(void);
-    void** (*const right)(void);
+    void** (*const left)(const BinaryTree* this);
+    void** (*const right)(const BinaryTree* this);
 };
 
 struct ChainingGet{
@@ -75,9 +77,9 @@ struct ChainingGet{
 };
 
 struct ChainingPrint{
-    struct InorderPrint (*const inorder)(void(*callback)(const void* data));
-    struct PostorderPrint (*const postorder)(void(*callback)(const void* data));
-    struct PreorderPrint (*const preorder)(void(*callback)(const void* data));
+    struct InorderPrint (*const inorder)(void);
+    struct PostorderPrint (*const postorder)(void);
+    struct PreorderPrint (*const preorder)(void);
 };
 
 struct BinaryTreeADT{
@@ -90,14 +92,15 @@ struct BinaryTreeADT{
 };
 
 struct Find{
-    BinaryTreeADT (*const get)(void);
-    int (*const remove)(void);
+    BinaryTreeADT (*const get)(BinaryTree *this, const void* data, int(*const callback)(const void* d1, const void* d2));
+    int (*const remove)(BinaryTree *this, const void* data, int(*const callback)(const void* d1, const void* d2));
 };
 
 struct PrivateDataBinaryTree{
     BinaryTreeADT binary_tree_adt;
     unsigned int num_elements;
     unsigned int depth;
+    NodePool* pool;//NULL for malloc
 };
 
 struct BinaryTree{
@@ -105,20 +108,21 @@ struct BinaryTree{
     unsigned  int (*const get_num_elements)(BinaryTree *this);
     int (*const insert)(BinaryTree *this, const void* data, void(*const callback_insert)(const void* data), int(*const callback_order)(const void* new, const void* inserted));
     int (*const insert_multiple)(BinaryTree *this, void(*const callback_insert)(const void* data), int(*const callback_order)(const void* new, const void* inserted),  int count, ...);
-    struct Find (*const find)(BinaryTree *this, const void* data, int(*const callback)(const void* d1, const void* d2));
+    struct Find (*const find)(BinaryTree *this);
     int (*const empty)(BinaryTree *this);
     struct ChainingGet (*const get)(const BinaryTree* this);
     struct ChainingPrint (*const print)(const BinaryTree* this);
 };
 
 BinaryTree newBinaryTree();
+BinaryTree newPooledBinaryTree(NodePool *pool);
 void destroyBinaryTree(BinaryTree *this);
 
 static int _insert_binary_tree(BinaryTree *this, const void* data, void(*const callback_insert)(const void* data), int(*const callback_order)(const void* new, const void* inserted) );
 static int _insert_multiple_binary_tree(BinaryTree *this, void(*const callback_insert)(const void* data), int(*const callback_order)(const void* new, const void* inserted),  int count, ...);
 static struct ChainingGet _get_binary_tree(const BinaryTree *this);
 static struct ChainingPrint _print_binary_tree(const BinaryTree *this);
-static struct Find _find_binary_tree(BinaryTree *this, const void* data, int (*const callback)(const void* d1, const void* d2));
+static struct Find _find_binary_tree(BinaryTree *this);
 static int _empty_binary_tree(BinaryTree *this);
 static unsigned int _get_num_elements(BinaryTree *this);
 
@@ -28,24 +28,24 @@ int main(){
 
     b.insert_multiple(&b, NULL, order_callback, 10,&d[0], &d[1], &d[2], &d[3], &d[4], &d[5], &d[6], &d[7], &d[8], &d[9]);
     printf("Inorder DES:");
-    b.print(&b).inorder(print_callback).des();
+    b.print(&b).inorder().des(&b, print_callback);
     printf("\nInorder ASC:");
-    b.print(&b).inorder(print_callback).asc();
+    b.print(&b).inorder().asc(&b, print_callback);
     printf("\nPreorder left:");
-    b.print(&b).preorder(print_callback).left();
+    b.print(&b).preorder().left(&b, print_callback);
     printf("\nPreorder right:");
-    b.print(&b).preorder(print_callback).right();
+    b.print(&b).preorder().right(&b, print_callback);
     printf("\nPostorder left:");
-    b.print(&b).postorder(print_callback).left();
+    b.print(&b).postorder().left(&b, print_callback);
     printf("\nPostorder right:");
-    b.print(&b).postorder(print_callback).right();
+    b.print(&b).postorder().right(&b, print_callback);
 
     data_struct d_new, d2_new ;
     d_new.num = 567, d2_new.num = 2;
     b.insert_multiple(&b, NULL, order_callback, 2, &d_new, &d2_new);
 
     printf("\nSize:%d\n", b.get_num_elements(&b));
-    data_struct** data_struct1 = (data_struct**)b.get(&b).inorder().asc();
+    data_struct** data_struct1 = (data_struct**)b.get(&b).inorder().asc(&b);
     int i = 0;
     for(i=0; i<b.get_num_elements(&b); i++){
         printf("%d-", data_struct1[i]->num);
@@ -55,15 +55,15 @@ int main(){
 
     data_struct s;
     s.num = 2;
-    printf("\nFind 2: %s",   b.find(&b, &s, search_callback).get() !=NULL? "yes":"no" );
+    printf("\nFind 2: %s",   b.find(&b).get(&b, &s, search_callback) !=NULL? "yes":"no" );
     s.num = 31;
-    printf("\nFind 31: %s", b.find(&b, &s, search_callback).get() !=NULL? "yes":"no" );
+    printf("\nFind 31: %s", b.find(&b).get(&b, &s, search_callback) !=NULL? "yes":"no" );
 
     //REMOVE
     s.num = 1;
-    printf("\nRemove 1: %s", b.find(&b, &s, remove_callback).remove()==1?"yes":"no");
+    printf("\nRemove 1: %s", b.find(&b).remove(&b, &s, remove_callback)==1?"yes":"no");
     printf("\nInorder ASC:");
-    b.print(&b).inorder(print_callback).asc();
+    b.print(&b).inorder().asc(&b, print_callback);
 
 
 
@@ -18,10 +18,10 @@ int main(){
         pyramidTree.insert(&pyramidTree, &i, NULL);
     }
     printf("\ndepth left des:\n");
-    pyramidTree.print(&pyramidTree).depth(callback_print).left().des();
+    pyramidTree.print(&pyramidTree).depth().left().des(&pyramidTree, callback_print);
     printf("\ndepth right des:\n");
 
-    pyramidTree.print(&pyramidTree).depth(callback_print).right().des();
+    pyramidTree.print(&pyramidTree).depth().right().des(&pyramidTree, callback_print);
 
 //    destroyPyramidTree(&pyramidTree);
     return 0;
@@ -8,6 +8,17 @@
  * @return PyramidTree
  */
 PyramidTree newPyramidTree(){
+    return newPooledPyramidTree(NULL);
+}
+
+/**
+ *
+ * @details Nodes come from pool, which must outlive the tree. A pool with
+ * nodes smaller than a PyramidTreeADT is ignored.
+ * @param pool NULL for malloc
+ * @return PyramidTree
+ */
+PyramidTree newPooledPyramidTree(NodePool *pool){
     PyramidTree pyramidTree;
     struct PrivateDataPyramidTree *dataPyramidTree = malloc(sizeof(struct PrivateDataPyramidTree));
 
@@ -16,6 +27,7 @@ PyramidTree newPyramidTree(){
     dataPyramidTree->num_elements = 0;
     dataPyramidTree->first_node = NULL;
     dataPyramidTree->last_node = NULL;
+    dataPyramidTree->pool = acceptNodePool(pool, sizeof(ELEMENT_PYRAMID_TREE));
 
     // PYRAMID TREE
     pyramidTree.private = dataPyramidTree;
@@ -41,6 +53,7 @@ PyramidTree *newPtrPyramidTree(){
     dataPyramidTree->num_elements = 0;
     dataPyramidTree->first_node = NULL;
     dataPyramidTree->last_node = NULL;
+    dataPyramidTree->pool = NULL;
 
     // PYRAMID TREE
     pyramidTree->private = dataPyramidTree;
@@ -67,13 +80,14 @@ void destroyPyramidTree(PyramidTree *this){
 
 /**
  *
+ * @param pool
  * @param right_father
  * @param data_to_insert
  * @param callback
  * @return
  */
-static PyramidTreeADT new_node(PyramidTreeADT right_father, PyramidTreeADT left_father, const void* data_to_insert, void(*const callback)(const void* data)){
-    PyramidTreeADT new = (PyramidTreeADT)malloc(sizeof(ELEMENT_PYRAMID_TREE));
+static PyramidTreeADT new_node(NodePool *pool, PyramidTreeADT right_father, PyramidTreeADT left_father, const void* data_to_insert, void(*const callback)(const void* data)){
+    PyramidTreeADT new = (PyramidTreeADT)allocNode(pool, sizeof(ELEMENT_PYRAMID_TREE));
     if(callback != NULL)
         callback(data_to_insert);
     new->data = malloc(sizeof(void*));
@@ -88,13 +102,13 @@ static PyramidTreeADT new_node(PyramidTreeADT right_father, PyramidTreeADT left_
 
 /**
  *
- * @param father
+ * @param pool
  * @param data_to_insert
  * @param callback
  * @return
  */
-static PyramidTreeADT new_node_head(const void* data_to_insert, void(*const callback)(const void* data)){
-    PyramidTreeADT new = (PyramidTreeADT)malloc(sizeof(ELEMENT_PYRAMID_TREE));
+static PyramidTreeADT new_node_head(NodePool *pool, const void* data_to_insert, void(*const callback)(const void* data)){
+    PyramidTreeADT new = (PyramidTreeADT)allocNode(pool, sizeof(ELEMENT_PYRAMID_TREE));
     if(callback != NULL)
         callback(data_to_insert);
     new->data = malloc(sizeof(void*));
@@ -120,7 +134,7 @@ int _insert_pyramid_tree(PyramidTree *this, const void* data_to_insert, void(*co
     //first element
     struct PrivateDataPyramidTree *private = (struct PrivateDataPyramidTree*)this->private;
     if( private->first_node == NULL) {
-        private->last_node = private->first_node = new_node_head(data_to_insert, callback_insert);
+        private->last_node = private->first_node = new_node_head(private->pool, data_to_insert, callback_insert);
     }else{
         PyramidTreeADT tmp = private->last_node;
 
@@ -130,13 +144,13 @@ int _insert_pyramid_tree(PyramidTree *this, const void* data_to_insert, void(*co
                 while(tmp->left_son != NULL)
                     tmp = tmp->left_son;
             }
-            private->last_node = tmp->left_son = new_node(tmp, NULL, data_to_insert, callback_insert );
+            private->last_node = tmp->left_son = new_node(private->pool, tmp, NULL, data_to_insert, callback_insert );
 
         }else if( tmp->right_father != NULL ){
             if(tmp->right_father->right_father == NULL)
-                private->last_node = tmp->right_father->right_son = new_node(NULL, tmp->right_father, data_to_insert, callback_insert );
+                private->last_node = tmp->right_father->right_son = new_node(private->pool, NULL, tmp->right_father, data_to_insert, callback_insert );
             else
-                tmp->right_father->right_father->right_son->left_son = private->last_node = tmp->right_father->right_son = new_node(tmp->right_father->right_father->right_son, tmp->right_father, data_to_insert, callback_insert );
+                tmp->right_father->right_father->right_son->left_son = private->last_node = tmp->right_father->right_son = new_node(private->pool, tmp->right_father->right_father->right_son, tmp->right_father, data_to_insert, callback_insert );
         }
     }
     private->num_elements++;
@@ -161,25 +175,22 @@ unsigned int _get_num_elements_pyramid_tree(PyramidTree *this){
 int _empty_pyramid_tree(PyramidTree *this){
     struct PrivateDataPyramidTree *private = (struct PrivateDataPyramidTree*)this->private;
     if(private->num_elements > 0){
-        PyramidTreeADT level = private->first_node;
-        PyramidTreeADT tmp;
-        while(level->right_son != NULL){
-            level = level->right_son;
-        }
-        if(level == private->last_node){
-            level = private->last_node->left_father;
-        }
-        while(private->num_elements > 0){
-            tmp = private->last_node;
-            if(private->last_node->left_father == NULL){
-                private->last_node = level;
-            }else{
-                private->last_node = private->last_node->left_father->left_son;
+        //every node once: down the left sons, starting from each right son of the top
+        PyramidTreeADT first = private->first_node;
+        while(first != NULL){
+            PyramidTreeADT next_first = first->right_son;
+            PyramidTreeADT tmp = first;
+            while(tmp != NULL){
+                PyramidTreeADT son = tmp->left_son;
+                free(tmp->data);
+                releaseNode(private->pool, tmp);
+                private->num_elements--;
+                tmp = son;
             }
-            free(tmp->data);
-            free(tmp);
-            private->num_elements--;
+            first = next_first;
         }
+        private->first_node = private->last_node = NULL;
+        private->height = 0;
         return 1;
     } else{
         return 0;
@@ -196,132 +207,146 @@ int _empty_pyramid_tree(PyramidTree *this){
 /**
  *
  * @param this
- * @return
+ * @param callback
  */
-struct ChainingPrint _print_pyramid_tree(const PyramidTree* this){
-    static struct PrivateDataPyramidTree *privateDataPyramidTree;
-    privateDataPyramidTree = this->private;
-    struct DepthPrint depthPrint(void(*const callback)(const void* data)){
-        static void (*fun)(const void* data);
-        fun = callback;
-        struct LeftPrint leftPrint(void){
-
-            void des(void){
-                PyramidTreeADT first = privateDataPyramidTree->first_node;
-                while(first != NULL) {
-                    PyramidTreeADT tmp = first;
-                    if (fun != NULL)
-                        fun(first->data);
-                    while (tmp->left_son != NULL) {
-                        tmp = tmp->left_son;
-                        if (fun != NULL)
-                            fun(tmp->data);
-                    }
-                    first = first->right_son;
-                }
-            }
-
-            void asc(void){
-
-            }
-
-            struct LeftPrint leftPrint = {
-                .asc = asc,
-                .des = des
-            };
-
-            return leftPrint;
+static void _print_depth_left_des_pyramid_tree(const PyramidTree* this, void(*const callback)(const void* data)){
+    struct PrivateDataPyramidTree *private = (struct PrivateDataPyramidTree*)this->private;
+    PyramidTreeADT first = private->first_node;
+    while(first != NULL) {
+        PyramidTreeADT tmp = first;
+        if (callback != NULL)
+            callback(first->data);
+        while (tmp->left_son != NULL) {
+            tmp = tmp->left_son;
+            if (callback != NULL)
+                callback(tmp->data);
         }
+        first = first->right_son;
+    }
+}
 
-        struct RightPrint rightPrint(void){
-
-            void des(void){
-                PyramidTreeADT first = privateDataPyramidTree->first_node;
-                while(first != NULL) {
-                    PyramidTreeADT tmp = first;
-                    if (fun != NULL)
-                        fun(first->data);
-                    while (tmp->right_son != NULL) {
-                        tmp = tmp->right_son;
-                        if (fun != NULL)
-                            fun(tmp->data);
-                    }
-                    first = first->left_son;
-                }
-            }
-
-            void asc(void){
-
-            }
-
-            struct RightPrint rightPrint = {
-                .asc = asc,
-                .des = des
-            };
-
-            return rightPrint;
+/**
+ *
+ * @param this
+ * @param callback
+ */
+static void _print_depth_right_des_pyramid_tree(const PyramidTree* this, void(*const callback)(const void* data)){
+    struct PrivateDataPyramidTree *private = (struct PrivateDataPyramidTree*)this->private;
+    PyramidTreeADT first = private->first_node;
+    while(first != NULL) {
+        PyramidTreeADT tmp = first;
+        if (callback != NULL)
+            callback(first->data);
+        while (tmp->right_son != NULL) {
+            tmp = tmp->right_son;
+            if (callback != NULL)
+                callback(tmp->data);
         }
-
-        struct DepthPrint depthPrint = {
-            .left = leftPrint,
-            .right = rightPrint
-        };
-
-        return depthPrint;
+        first = first->left_son;
     }
+}
 
-    struct WidthPrint widthPrint(void(*const callback)(const void* data)){
-
-        struct LeftPrint leftPrint(void){
-
-            void des(void){
-
-            }
+/**
+ *
+ * @details Traversals not written yet.
+ * @param this
+ * @param callback
+ */
+static void _print_none_pyramid_tree(const PyramidTree* this, void(*const callback)(const void* data)){
 
-            void asc(void){
+}
 
-            }
+static const struct LeftPrint depth_left_print = {
+    .asc = _print_none_pyramid_tree,
+    .des = _print_depth_left_des_pyramid_tree
+};
 
-            struct LeftPrint leftPrint = {
-                    .asc = asc,
-                    .des = des
-            };
+static const struct RightPrint depth_right_print = {
+    .asc = _print_none_pyramid_tree,
+    .des = _print_depth_right_des_pyramid_tree
+};
 
-            return leftPrint;
-        }
+static const struct LeftPrint width_left_print = {
+    .asc = _print_none_pyramid_tree,
+    .des = _print_none_pyramid_tree
+};
 
-        struct RightPrint rightPrint(void){
+static const struct RightPrint width_right_print = {
+    .asc = _print_none_pyramid_tree,
+    .des = _print_none_pyramid_tree
+};
 
-            void des(void){
+/**
+ *
+ * @return
+ */
+static struct LeftPrint _print_depth_left_pyramid_tree(void){
+    return depth_left_print;
+}
 
-            }
+/**
+ *
+ * @return
+ */
+static struct RightPrint _print_depth_right_pyramid_tree(void){
+    return depth_right_print;
+}
 
-            void asc(void){
+/**
+ *
+ * @return
+ */
+static struct LeftPrint _print_width_left_pyramid_tree(void){
+    return width_left_print;
+}
 
-            }
+/**
+ *
+ * @return
+ */
+static struct RightPrint _print_width_right_pyramid_tree(void){
+    return width_right_print;
+}
 
-            struct RightPrint rightPrint = {
-                    .asc = asc,
-                    .des = des
-            };
+static const struct DepthPrint depth_print = {
+    .left = _print_depth_left_pyramid_tree,
+    .right = _print_depth_right_pyramid_tree
+};
 
-            return rightPrint;
-        }
+static const struct WidthPrint width_print = {
+    .left = _print_width_left_pyramid_tree,
+    .right = _print_width_right_pyramid_tree
+};
 
-        struct WidthPrint widthPrint = {
-            .left = leftPrint,
-            .right = rightPrint
-        };
+/**
+ *
+ * @return
+ */
+static struct DepthPrint _print_depth_pyramid_tree(void){
+    return depth_print;
+}
 
-        return widthPrint;
-    }
+/**
+ *
+ * @return
+ */
+static struct WidthPrint _print_width_pyramid_tree(void){
+    return width_print;
+}
 
-    struct ChainingPrint chainingPrint = {
-        .depth = depthPrint,
-        .width = widthPrint
-    };
+static const struct ChainingPrint chaining_print = {
+    .depth = _print_depth_pyramid_tree,
+    .width = _print_width_pyramid_tree
+};
 
-    return chainingPrint;
+/**
+ *
+ * @details tree.print(&tree).depth().left().des(&tree, callback).
+ * @param this
+ * @return
+ */
+struct ChainingPrint _print_pyramid_tree(const PyramidTree* this){
+    return chaining_print;
 }
 
 /**
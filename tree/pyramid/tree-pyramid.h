@@ -6,6 +6,7 @@
 #define TREE_PYRAMID_H
 #include <memory.h>
 #include <malloc.h>
+#include "../../pool/node_pool.h"
 
 
 #ifdef __cplusplus
@@ -16,13 +17,13 @@ typedef struct PyramidTree PyramidTree;
 typedef struct PyramidTreeADT* PyramidTreeADT, ELEMENT_PYRAMID_TREE;
 
 struct RightPrint{
-    void (*const asc)(void);
-    void (*const des)(void);
+    void (*const asc)(const PyramidTree* this, void(*const callback)(const void* data));
+    void (*const des)(const PyramidTree* this, void(*const callback)(const void* data));
 };
 
 struct LeftPrint{
-    void (*const asc)(void);
-    void (*const des)(void);
+    void (*const asc)(const PyramidTree* this, void(*const callback)(const void* data));
+    void (*const des)(const PyramidTree* this, void(*const callback)(const void* data));
 };
 
 struct DepthPrint{
@@ -36,8 +37,8 @@ struct WidthPrint{
 };
 
 struct ChainingPrint{
-    struct DepthPrint (*const depth)(void(*const callback)(const void* data));
-    struct WidthPrint (*const width)(void(*const callback)(const void* data));
+    struct DepthPrint (*const depth)(void);
+    struct WidthPrint (*const width)(void);
 };
 
 struct RightGet{
@@ -80,6 +81,7 @@ struct PrivateDataPyramidTree{
     PyramidTreeADT last_node;
     unsigned int num_elements;
     unsigned int height;
+    NodePool* pool;//NULL for malloc
 };
 
 
@@ -98,6 +100,13 @@ struct PyramidTree{
  */
 PyramidTree newPyramidTree();
 
+/**
+ *
+ * @param pool NULL for malloc
+ * @return
+ */
+PyramidTree newPooledPyramidTree(NodePool *pool);
+
 /**
  *
  * @return